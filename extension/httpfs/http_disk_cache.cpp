@@ -0,0 +1,237 @@
+#include "http_disk_cache.hpp"
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+
+#include <algorithm>
+#ifndef _WIN32
+#include <utime.h>
+#else
+#include <sys/utime.h>
+#endif
+
+namespace duckdb {
+
+HTTPDiskCache::HTTPDiskCache(string directory_p, idx_t max_size_p)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), max_size(max_size_p), total_size(0),
+      written_since_scan(0) {
+	if (!fs->DirectoryExists(directory)) {
+		fs->CreateDirectory(directory);
+	}
+	ScanDirectory();
+	EvictBlocks();
+}
+
+shared_ptr<HTTPDiskCache> HTTPDiskCache::Get(const string &directory, idx_t max_size) {
+	static mutex caches_lock;
+	static unordered_map<string, shared_ptr<HTTPDiskCache>> caches;
+	shared_ptr<HTTPDiskCache> cache;
+	{
+		lock_guard<mutex> guard(caches_lock);
+		auto entry = caches.find(directory);
+		if (entry == caches.end()) {
+			cache = make_shared_ptr<HTTPDiskCache>(directory, max_size);
+			caches[directory] = cache;
+			return cache;
+		}
+		cache = entry->second;
+	}
+	cache->SetMaxSize(max_size);
+	return cache;
+}
+
+idx_t HTTPDiskCache::GetMaxSize() {
+	lock_guard<mutex> guard(lock);
+	return max_size;
+}
+
+void HTTPDiskCache::SetMaxSize(idx_t max_size_p) {
+	{
+		lock_guard<mutex> guard(lock);
+		if (max_size == max_size_p) {
+			return;
+		}
+		max_size = max_size_p;
+	}
+	EvictBlocks();
+}
+
+//! Sets the modification time of a block file to the current time - blocks are ordered by it when the directory is
+//! scanned, so it has to reflect the last use of the block
+static void SetLastUsedTime(const string &path) {
+#ifndef _WIN32
+	utime(path.c_str(), nullptr);
+#else
+	_utime(path.c_str(), nullptr);
+#endif
+}
+
+string HTTPDiskCache::GetBlockPath(const string &key, idx_t block_idx) {
+	auto key_hash = Hash(key.c_str(), key.size());
+	return fs->JoinPath(directory, StringUtil::Format("%016llx_%llu%s", key_hash, block_idx, BLOCK_EXTENSION));
+}
+
+bool HTTPDiskCache::TryRead(const string &key, idx_t block_idx, idx_t block_size, idx_t offset_in_block,
+                            data_ptr_t buffer, idx_t length) {
+	D_ASSERT(offset_in_block + length <= block_size);
+	auto path = GetBlockPath(key, block_idx);
+	auto header_size = sizeof(uint32_t) + key.size();
+	try {
+		auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			return false;
+		}
+		// the block can be incomplete if it was written by a process that crashed, or its name can collide with the
+		// name of a block of a different key
+		auto file_size = NumericCast<idx_t>(fs->GetFileSize(*handle));
+		if (file_size != header_size + block_size) {
+			handle.reset();
+			Remove(path);
+			return false;
+		}
+		auto header = Allocator::DefaultAllocator().Allocate(header_size);
+		fs->Read(*handle, header.get(), NumericCast<int64_t>(header_size), 0);
+		if (Load<uint32_t>(header.get()) != key.size() ||
+		    memcmp(header.get() + sizeof(uint32_t), key.c_str(), key.size()) != 0) {
+			return false;
+		}
+		fs->Read(*handle, buffer, NumericCast<int64_t>(length), header_size + offset_in_block);
+		handle.reset();
+		SetLastUsedTime(path);
+		Touch(path, file_size);
+		return true;
+	} catch (std::exception &ex) {
+		// a block that cannot be read (e.g. because it was evicted by another process) is a cache miss
+		return false;
+	}
+}
+
+void HTTPDiskCache::Write(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size) {
+	auto path = GetBlockPath(key, block_idx);
+	auto temp_path = path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	auto header_size = sizeof(uint32_t) + key.size();
+	try {
+		{
+			auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			auto header = Allocator::DefaultAllocator().Allocate(header_size);
+			Store<uint32_t>(NumericCast<uint32_t>(key.size()), header.get());
+			memcpy(header.get() + sizeof(uint32_t), key.c_str(), key.size());
+			fs->Write(*handle, header.get(), NumericCast<int64_t>(header_size), 0);
+			fs->Write(*handle, const_cast<data_ptr_t>(buffer), NumericCast<int64_t>(block_size), header_size);
+			handle->Close();
+		}
+		// renaming is atomic, so other processes either see the complete block or no block at all
+		fs->MoveFile(temp_path, path);
+	} catch (std::exception &ex) {
+		// failing to write to the cache (e.g. because the disk is full) does not fail the read
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (...) { // NOLINT
+		}
+		return;
+	}
+	Touch(path, header_size + block_size);
+	bool rescan;
+	{
+		lock_guard<mutex> guard(lock);
+		written_since_scan += header_size + block_size;
+		rescan = written_since_scan >= max_size / RESCAN_FRACTION;
+	}
+	if (rescan) {
+		// other processes that share the directory write blocks as well, their blocks count towards the size bound
+		ScanDirectory();
+	}
+	EvictBlocks();
+}
+
+void HTTPDiskCache::Touch(const string &path, idx_t size) {
+	lock_guard<mutex> guard(lock);
+	auto entry = blocks.find(path);
+	if (entry != blocks.end()) {
+		total_size -= entry->second->second;
+		lru.erase(entry->second);
+	}
+	lru.emplace_front(path, size);
+	blocks[path] = lru.begin();
+	total_size += size;
+}
+
+void HTTPDiskCache::Remove(const string &path) {
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = blocks.find(path);
+		if (entry != blocks.end()) {
+			total_size -= entry->second->second;
+			lru.erase(entry->second);
+			blocks.erase(entry);
+		}
+	}
+	try {
+		fs->RemoveFile(path);
+	} catch (...) { // NOLINT
+	}
+}
+
+void HTTPDiskCache::EvictBlocks() {
+	vector<string> evicted_blocks;
+	{
+		lock_guard<mutex> guard(lock);
+		while (total_size > max_size && !lru.empty()) {
+			auto &block = lru.back();
+			total_size -= block.second;
+			blocks.erase(block.first);
+			evicted_blocks.push_back(std::move(block.first));
+			lru.pop_back();
+		}
+	}
+	// blocks that are being read by another thread or process can still be read after they are removed (or the read
+	// fails, which is a cache miss)
+	for (auto &path : evicted_blocks) {
+		try {
+			fs->RemoveFile(path);
+		} catch (...) { // NOLINT
+		}
+	}
+}
+
+void HTTPDiskCache::ScanDirectory() {
+	struct ExistingBlock {
+		string path;
+		idx_t size;
+		time_t last_used;
+	};
+	vector<ExistingBlock> existing_blocks;
+	fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory || !StringUtil::EndsWith(name, BLOCK_EXTENSION)) {
+			return;
+		}
+		auto path = fs->JoinPath(directory, name);
+		try {
+			auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (!handle) {
+				return;
+			}
+			auto size = NumericCast<idx_t>(fs->GetFileSize(*handle));
+			existing_blocks.push_back(ExistingBlock {path, size, fs->GetLastModifiedTime(*handle)});
+		} catch (...) { // NOLINT
+		}
+	});
+	// the most recently used blocks go to the front
+	std::sort(existing_blocks.begin(), existing_blocks.end(),
+	          [](const ExistingBlock &a, const ExistingBlock &b) { return a.last_used > b.last_used; });
+
+	lock_guard<mutex> guard(lock);
+	lru.clear();
+	blocks.clear();
+	total_size = 0;
+	written_since_scan = 0;
+	for (auto &block : existing_blocks) {
+		lru.emplace_back(std::move(block.path), block.size);
+		blocks[lru.back().first] = std::prev(lru.end());
+		total_size += block.size;
+	}
+}
+
+} // namespace duckdb
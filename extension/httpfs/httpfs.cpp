@@ -42,6 +42,8 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	std::string ca_cert_file;
 	uint64_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	string disk_cache_directory;
+	uint64_t disk_cache_max_size = DEFAULT_DISK_CACHE_MAX_SIZE;
 
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
@@ -71,6 +73,12 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", value)) {
 		hf_max_per_page = value.GetValue<uint64_t>();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_directory", value) && !value.IsNull()) {
+		disk_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_max_size", value) && !value.IsNull()) {
+		disk_cache_max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
 	return {timeout,
 	        retries,
@@ -81,7 +89,9 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	        enable_server_cert_verification,
 	        ca_cert_file,
 	        "",
-	        hf_max_per_page};
+	        hf_max_per_page,
+	        disk_cache_directory,
+	        disk_cache_max_size};
 }
 
 unique_ptr<duckdb_httplib_openssl::Client> HTTPClientCache::GetClient() {
@@ -255,17 +265,25 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, strin
 	string path, proto_host_port;
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
+	// PUT requests of the same file can run concurrently (e.g. the parts of a multipart upload), each takes its own
+	// client from the cache so connections are reused across requests
+	auto http_client = hfs.GetClient(nullptr);
 
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
-		auto client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
 		if (hfs.state) {
 			hfs.state->put_count++;
 			hfs.state->total_bytes_sent += buffer_in_len;
 		}
-		return client->Put(path.c_str(), *headers, buffer_in, buffer_in_len, "application/octet-stream");
+		return http_client->Put(path.c_str(), *headers, buffer_in, buffer_in_len, "application/octet-stream");
 	});
 
-	return RunRequestWithRetry(request, url, "PUT", hfs.http_params);
+	// Refresh the client on retries
+	std::function<void(void)> on_retry(
+	    [&]() { http_client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
+
+	auto response = RunRequestWithRetry(request, url, "PUT", hfs.http_params, on_retry);
+	hfs.StoreClient(std::move(http_client));
+	return response;
 }
 
 unique_ptr<ResponseWrapper> HTTPFileSystem::HeadRequest(FileHandle &handle, string url, HeaderMap header_map) {
@@ -423,8 +441,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -487,7 +505,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRange(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -523,14 +541,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -540,6 +557,60 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes) {
+	if (!hfh.disk_cache || nr_bytes == 0 || location + nr_bytes > hfh.length) {
+		GetRangeRequest(hfh, hfh.path, {}, location, buffer, nr_bytes);
+		return;
+	}
+	auto &disk_cache = *hfh.disk_cache;
+	const auto block_size = HTTPDiskCache::BLOCK_SIZE;
+	const auto end = location + nr_bytes;
+	const auto first_block = location / block_size;
+	const auto last_block = (end - 1) / block_size;
+
+	// Fetches the blocks [start_block, end_block), stores them in the cache and copies the requested part of them
+	auto fetch_blocks = [&](idx_t start_block, idx_t end_block) {
+		auto fetch_start = start_block * block_size;
+		auto fetch_end = MinValue<idx_t>(end_block * block_size, hfh.length);
+		auto fetch_buffer = duckdb::unique_ptr<char[]>(new char[fetch_end - fetch_start]);
+		GetRangeRequest(hfh, hfh.path, {}, fetch_start, fetch_buffer.get(), fetch_end - fetch_start);
+		for (idx_t block_idx = start_block; block_idx < end_block; block_idx++) {
+			auto block_start = block_idx * block_size;
+			auto block_length = MinValue<idx_t>(block_size, hfh.length - block_start);
+			disk_cache.Write(hfh.disk_cache_key, block_idx,
+			                 const_data_ptr_cast(fetch_buffer.get() + (block_start - fetch_start)), block_length);
+		}
+		auto copy_start = MaxValue<idx_t>(location, fetch_start);
+		auto copy_end = MinValue<idx_t>(end, fetch_end);
+		auto copy_length = copy_end - copy_start;
+		memcpy(buffer + (copy_start - location), fetch_buffer.get() + (copy_start - fetch_start), copy_length);
+	};
+
+	// Consecutive blocks that are not cached are fetched with a single request
+	auto missing_start = DConstants::INVALID_INDEX;
+	for (idx_t block_idx = first_block; block_idx <= last_block; block_idx++) {
+		auto block_start = block_idx * block_size;
+		auto block_length = MinValue<idx_t>(block_size, hfh.length - block_start);
+		auto read_start = MaxValue<idx_t>(location, block_start);
+		auto read_end = MinValue<idx_t>(end, block_start + block_length);
+		auto cached = disk_cache.TryRead(hfh.disk_cache_key, block_idx, block_length, read_start - block_start,
+		                                 data_ptr_cast(buffer + (read_start - location)), read_end - read_start);
+		if (!cached) {
+			if (missing_start == DConstants::INVALID_INDEX) {
+				missing_start = block_idx;
+			}
+			continue;
+		}
+		if (missing_start != DConstants::INVALID_INDEX) {
+			fetch_blocks(missing_start, block_idx);
+			missing_start = DConstants::INVALID_INDEX;
+		}
+	}
+	if (missing_start != DConstants::INVALID_INDEX) {
+		fetch_blocks(missing_start, last_block + 1);
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -642,10 +713,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeDiskCache();
 			return;
 		}
 
@@ -751,10 +824,24 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeDiskCache();
+}
+
+void HTTPFileHandle::InitializeDiskCache() {
+	if (http_params.disk_cache_directory.empty() || !flags.OpenForReading() || cached_file_handle || length == 0) {
+		return;
+	}
+	if (etag.empty() && last_modified == 0) {
+		// we cannot tell whether the file was modified, so we cannot cache it
+		return;
 	}
+	disk_cache = HTTPDiskCache::Get(http_params.disk_cache_directory, http_params.disk_cache_max_size);
+	disk_cache_key = path + "\n" + to_string(length) + "\n" + (etag.empty() ? to_string(last_modified) : etag);
 }
 
 unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::GetClient(optional_ptr<ClientContext> context) {
@@ -13,6 +13,7 @@ source_files = [
         for s in [
             'create_secret_functions.cpp',
             'crypto.cpp',
+            'http_disk_cache.cpp',
             'hffs.cpp',
             'httpfs.cpp',
             'httpfs_extension.cpp',
@@ -10,6 +10,32 @@
 
 namespace duckdb {
 
+static idx_t GetHTTPDiskCacheMaxSize(ClientContext &context) {
+	Value value;
+	if (context.TryGetCurrentSetting("http_disk_cache_max_size", value) && !value.IsNull()) {
+		return DBConfig::ParseMemoryLimit(value.ToString());
+	}
+	return HTTPParams::DEFAULT_DISK_CACHE_MAX_SIZE;
+}
+
+// The disk cache is opened as soon as it is configured, so blocks in the directory that exceed the size bound (e.g.
+// written by earlier processes) are evicted right away
+static void SetHTTPDiskCacheDirectory(ClientContext &context, SetScope scope, Value &parameter) {
+	auto directory = parameter.IsNull() ? string() : parameter.ToString();
+	if (!directory.empty()) {
+		HTTPDiskCache::Get(directory, GetHTTPDiskCacheMaxSize(context));
+	}
+}
+
+static void SetHTTPDiskCacheMaxSize(ClientContext &context, SetScope scope, Value &parameter) {
+	auto max_size = DBConfig::ParseMemoryLimit(parameter.ToString());
+	Value directory;
+	if (context.TryGetCurrentSetting("http_disk_cache_directory", directory) && !directory.IsNull() &&
+	    !directory.ToString().empty()) {
+		HTTPDiskCache::Get(directory.ToString(), max_size);
+	}
+}
+
 static void LoadInternal(DatabaseInstance &instance) {
 	S3FileSystem::Verify(); // run some tests to see if all the hashes work out
 	auto &fs = instance.GetFileSystem();
@@ -39,6 +65,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_disk_cache_directory",
+	                          "Directory in which blocks of remote files are cached. The cache is disabled if empty",
+	                          LogicalType::VARCHAR, Value(""), SetHTTPDiskCacheDirectory);
+	config.AddExtensionOption("http_disk_cache_max_size", "Maximum size of the disk cache for blocks of remote files",
+	                          LogicalType::VARCHAR, Value("4GB"), SetHTTPDiskCacheMaxSize);
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -57,6 +88,10 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::UBIGINT, Value(10000));
 	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader global thread limit", LogicalType::UBIGINT,
 	                          Value(50));
+	config.AddExtensionOption("s3_uploader_max_memory",
+	                          "S3 Uploader global memory limit for the write buffers of all files (defaults to half of "
+	                          "the memory limit)",
+	                          LogicalType::VARCHAR);
 
 	// HuggingFace options
 	config.AddExtensionOption("hf_max_per_page", "Debug option to limit number of items returned in list requests",
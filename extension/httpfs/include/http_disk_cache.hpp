@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// http_disk_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+//! Read-through cache of blocks of remote files on local disk. Every block is stored in its own file that starts with
+//! the key it belongs to, the key contains the URL and the validator (ETag or last modified time and length) of the
+//! file, so blocks of modified files are never returned. Blocks are written to a temporary file and then renamed, so
+//! the cache directory can be shared by concurrent processes. The total size of the cache is bounded, the least
+//! recently used blocks are evicted first. The modification time of a block is its last use, and the directory is
+//! rescanned regularly, so blocks used or written by other processes are taken into account as well
+class HTTPDiskCache {
+public:
+	//! The size of a cached block (the last block of a file can be smaller)
+	static constexpr const idx_t BLOCK_SIZE = 1 << 20;
+	static constexpr const char *BLOCK_EXTENSION = ".block";
+	//! The directory is rescanned whenever this fraction of the maximum size has been written since the last scan
+	static constexpr const idx_t RESCAN_FRACTION = 8;
+
+public:
+	HTTPDiskCache(string directory_p, idx_t max_size_p);
+
+	//! Returns the cache of the given directory - there is a single cache per directory within the process
+	static shared_ptr<HTTPDiskCache> Get(const string &directory, idx_t max_size);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	idx_t GetMaxSize();
+	void SetMaxSize(idx_t max_size);
+
+	//! Reads "length" bytes at "offset_in_block" from a cached block of "block_size" bytes, returns false if the block
+	//! is not cached
+	bool TryRead(const string &key, idx_t block_idx, idx_t block_size, idx_t offset_in_block, data_ptr_t buffer,
+	             idx_t length);
+	//! Stores a block in the cache
+	void Write(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size);
+
+private:
+	string GetBlockPath(const string &key, idx_t block_idx);
+	//! Marks a block as most recently used
+	void Touch(const string &path, idx_t size);
+	//! Removes a block that no longer holds the expected contents
+	void Remove(const string &path);
+	//! Evicts the least recently used blocks until the cache fits in "max_size" bytes
+	void EvictBlocks();
+	//! Replaces the blocks that are known with the blocks that are in the directory (e.g. written by an earlier or a
+	//! concurrent process), ordered by their last use
+	void ScanDirectory();
+
+private:
+	unique_ptr<FileSystem> fs;
+	const string directory;
+
+	mutex lock;
+	idx_t max_size;
+	idx_t total_size;
+	//! The number of bytes written to the cache since the directory was last scanned
+	idx_t written_since_scan;
+	//! The blocks in order of use, the most recently used block is at the front
+	list<pair<string, idx_t>> lru;
+	unordered_map<string, list<pair<string, idx_t>>::iterator> blocks;
+};
+
+} // namespace duckdb
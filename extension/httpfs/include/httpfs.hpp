@@ -7,6 +7,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_disk_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -41,6 +42,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr uint64_t DEFAULT_DISK_CACHE_MAX_SIZE = 1ULL << 32; // 4GB
 
 	uint64_t timeout;
 	uint64_t retries;
@@ -55,6 +57,10 @@ struct HTTPParams {
 
 	idx_t hf_max_per_page;
 
+	//! The directory of the disk cache for blocks of remote files, the disk cache is disabled if this is empty
+	string disk_cache_directory;
+	idx_t disk_cache_max_size;
+
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener);
 };
 
@@ -90,10 +96,15 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
 
+	// The disk cache for blocks of this file (if enabled), the key identifies the version of the file
+	shared_ptr<HTTPDiskCache> disk_cache;
+	string disk_cache_key;
+
 	// Read info
 	idx_t buffer_available;
 	idx_t buffer_idx;
@@ -121,6 +132,8 @@ public:
 protected:
 	//! Create a new Client
 	virtual unique_ptr<duckdb_httplib_openssl::Client> CreateClient(optional_ptr<ClientContext> client_context);
+	//! Sets up the disk cache once the length, last modified time and ETag of the file are known
+	void InitializeDiskCache();
 };
 
 class HTTPFileSystem : public FileSystem {
@@ -189,6 +202,8 @@ protected:
 	static duckdb::unique_ptr<ResponseWrapper>
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
+	//! Reads a range of a file, through the disk cache if it is enabled
+	void ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes);
 
 private:
 	// Global cache
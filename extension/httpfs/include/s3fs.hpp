@@ -2,9 +2,11 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/secret/secret.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
@@ -70,10 +72,13 @@ struct S3ConfigParams {
 	static constexpr uint64_t DEFAULT_MAX_FILESIZE = 800000000000; // 800GB
 	static constexpr uint64_t DEFAULT_MAX_PARTS_PER_FILE = 10000;  // AWS DEFAULT
 	static constexpr uint64_t DEFAULT_MAX_UPLOAD_THREADS = 50;
+	//! By default the write buffers of all S3 files together may use half of the memory limit
+	static constexpr uint64_t DEFAULT_MAX_UPLOAD_MEMORY = 0;
 
 	uint64_t max_file_size;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	uint64_t max_upload_memory;
 
 	static S3ConfigParams ReadFrom(optional_ptr<FileOpener> opener);
 };
@@ -88,16 +93,62 @@ public:
 };
 
 class S3FileSystem;
+class S3FileHandle;
+class S3WriteBuffer;
+
+struct S3UploadTask {
+	optional_ptr<S3FileHandle> file_handle;
+	shared_ptr<S3WriteBuffer> write_buffer;
+};
+
+//! Uploads the parts of all S3 multipart uploads of a file system on a shared, bounded pool of threads. The memory of
+//! the write buffers of all files is accounted for globally: allocating a new write buffer blocks while the budget is
+//! exhausted and uploads are in flight, which applies backpressure to the writers
+class S3UploadExecutor {
+public:
+	S3UploadExecutor();
+	~S3UploadExecutor();
+
+	//! Schedules the upload of a write buffer, the pool grows up to "max_threads" threads
+	void Schedule(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer, idx_t max_threads);
+	//! Reserves "size" bytes of write buffer memory, blocks while this would exceed the memory limit and there are
+	//! uploads in flight that will free up memory
+	void ReserveMemory(idx_t size, idx_t memory_limit);
+	//! Releases memory reserved with ReserveMemory
+	void ReleaseMemory(idx_t size);
+
+private:
+	void WorkerThread();
+
+private:
+	mutex lock;
+	//! Notifies the workers of new tasks (or shutdown)
+	std::condition_variable task_cv;
+	//! Notifies the writers waiting for memory
+	std::condition_variable memory_cv;
+	//! The uploads that have not been picked up by a worker yet
+	deque<S3UploadTask> tasks;
+	vector<thread> workers;
+	//! The number of uploads that are either queued or running
+	idx_t pending_uploads;
+	//! The memory that is reserved by write buffers
+	idx_t reserved_memory;
+	bool shutdown;
+};
 
 // Holds the buffered data for 1 part of an S3 Multipart upload
 class S3WriteBuffer {
 public:
-	explicit S3WriteBuffer(idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p)
-	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)) {
+	explicit S3WriteBuffer(idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p, S3UploadExecutor &executor)
+	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)), executor(executor) {
 		buffer_end = buffer_start + buffer_size;
 		part_no = buffer_start / buffer_size;
 		uploading = false;
 	}
+	~S3WriteBuffer() {
+		buffer.Destroy();
+		executor.ReleaseMemory(buffer_end - buffer_start);
+	}
 
 	void *Ptr() {
 		return buffer.Ptr();
@@ -111,6 +162,10 @@ public:
 	idx_t buffer_end;
 	BufferHandle buffer;
 	atomic<bool> uploading;
+
+private:
+	//! The executor that accounts for the memory of this buffer
+	S3UploadExecutor &executor;
 };
 
 class S3FileHandle : public HTTPFileHandle {
@@ -181,6 +236,8 @@ public:
 	}
 
 	BufferManager &buffer_manager;
+	//! The executor that uploads the parts of all multipart uploads
+	S3UploadExecutor upload_executor;
 	string GetName() const override;
 
 public:
@@ -225,8 +282,8 @@ public:
 	bool ListFiles(const string &directory, const std::function<void(const string &, bool)> &callback,
 	               FileOpener *opener = nullptr) override;
 
-	//! Wrapper around BufferManager::Allocate to limit the number of buffers
-	BufferHandle Allocate(idx_t part_size, uint16_t max_threads);
+	//! Wrapper around BufferManager::Allocate that limits the memory used by the write buffers of all files
+	BufferHandle Allocate(idx_t part_size, idx_t max_memory);
 
 	//! S3 is object storage so directories effectively always exist
 	bool DirectoryExists(const string &directory, optional_ptr<FileOpener> opener = nullptr) override {
@@ -301,6 +301,7 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	uint64_t uploader_max_filesize;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	uint64_t max_upload_memory;
 	Value value;
 
 	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_filesize", value)) {
@@ -321,7 +322,14 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 		max_upload_threads = S3ConfigParams::DEFAULT_MAX_UPLOAD_THREADS;
 	}
 
-	return {uploader_max_filesize, max_parts_per_file, max_upload_threads};
+	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_memory", value) && !value.IsNull() &&
+	    !value.GetValue<string>().empty()) {
+		max_upload_memory = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	} else {
+		max_upload_memory = S3ConfigParams::DEFAULT_MAX_UPLOAD_MEMORY;
+	}
+
+	return {uploader_max_filesize, max_parts_per_file, max_upload_threads, max_upload_memory};
 }
 
 void S3FileHandle::Close() {
@@ -366,6 +374,73 @@ string S3FileSystem::InitializeMultipartUpload(S3FileHandle &file_handle) {
 	return result.substr(open_tag_pos, close_tag_pos - open_tag_pos);
 }
 
+S3UploadExecutor::S3UploadExecutor() : pending_uploads(0), reserved_memory(0), shutdown(false) {
+}
+
+S3UploadExecutor::~S3UploadExecutor() {
+	{
+		lock_guard<mutex> lck(lock);
+		shutdown = true;
+	}
+	task_cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+void S3UploadExecutor::Schedule(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer,
+                                idx_t max_threads) {
+	{
+		lock_guard<mutex> lck(lock);
+		tasks.push_back(S3UploadTask {&file_handle, std::move(write_buffer)});
+		pending_uploads++;
+		// start a new worker if all workers are busy
+		if (pending_uploads > workers.size() && workers.size() < MaxValue<idx_t>(max_threads, 1)) {
+			workers.emplace_back([this] { WorkerThread(); });
+		}
+	}
+	task_cv.notify_one();
+}
+
+void S3UploadExecutor::WorkerThread() {
+	while (true) {
+		S3UploadTask task;
+		{
+			unique_lock<mutex> lck(lock);
+			task_cv.wait(lck, [this] { return shutdown || !tasks.empty(); });
+			if (tasks.empty()) {
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+		// note that the file handle can be destroyed as soon as the upload has notified it
+		S3FileSystem::UploadBuffer(*task.file_handle, std::move(task.write_buffer));
+		{
+			lock_guard<mutex> lck(lock);
+			pending_uploads--;
+		}
+		memory_cv.notify_all();
+	}
+}
+
+void S3UploadExecutor::ReserveMemory(idx_t size, idx_t memory_limit) {
+	unique_lock<mutex> lck(lock);
+	// if there are no uploads in flight no memory will be freed up by waiting - the buffers that are being filled by
+	// the writers are only uploaded once they are full, so we exceed the limit rather than deadlock
+	memory_cv.wait(lck, [&] { return reserved_memory + size <= memory_limit || pending_uploads == 0; });
+	reserved_memory += size;
+}
+
+void S3UploadExecutor::ReleaseMemory(idx_t size) {
+	{
+		lock_guard<mutex> lck(lock);
+		D_ASSERT(reserved_memory >= size);
+		reserved_memory -= size;
+	}
+	memory_cv.notify_all();
+}
+
 void S3FileSystem::NotifyUploadsInProgress(S3FileHandle &file_handle) {
 	{
 		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
@@ -399,7 +474,7 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 			throw IOException("Unexpected response when uploading part to S3");
 		}
 
-	} catch (IOException &ex) {
+	} catch (std::exception &ex) {
 		// Ensure only one thread sets the exception
 		bool f = false;
 		auto exchanged = file_handle.uploader_has_error.compare_exchange_strong(f, true);
@@ -459,8 +534,7 @@ void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuff
 		file_handle.uploads_in_progress++;
 	}
 
-	thread upload_thread(UploadBuffer, std::ref(file_handle), write_buffer);
-	upload_thread.detach();
+	upload_executor.Schedule(file_handle, std::move(write_buffer), file_handle.config_params.max_upload_threads);
 }
 
 // Note that FlushAll currently does not allow to continue writing afterwards. Therefore, FinalizeMultipartUpload should
@@ -521,9 +595,19 @@ void S3FileSystem::FinalizeMultipartUpload(S3FileHandle &file_handle) {
 	}
 }
 
-// Wrapper around the BufferManager::Allocate to that allows limiting the number of buffers that will be handed out
-BufferHandle S3FileSystem::Allocate(idx_t part_size, uint16_t max_threads) {
-	return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+// Wrapper around the BufferManager::Allocate that limits the memory used by the write buffers of all files, blocks
+// until enough uploads have finished
+BufferHandle S3FileSystem::Allocate(idx_t part_size, idx_t max_memory) {
+	if (max_memory == S3ConfigParams::DEFAULT_MAX_UPLOAD_MEMORY) {
+		max_memory = buffer_manager.GetMaxMemory() / 2;
+	}
+	upload_executor.ReserveMemory(part_size, max_memory);
+	try {
+		return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+	} catch (...) {
+		upload_executor.ReleaseMemory(part_size);
+		throw;
+	}
 }
 
 shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
@@ -539,9 +623,9 @@ shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
 		}
 	}
 
-	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_upload_threads);
-	auto new_write_buffer =
-	    make_shared_ptr<S3WriteBuffer>(write_buffer_idx * part_size, part_size, std::move(buffer_handle));
+	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_upload_memory);
+	auto new_write_buffer = make_shared_ptr<S3WriteBuffer>(write_buffer_idx * part_size, part_size,
+	                                                       std::move(buffer_handle), s3fs.upload_executor);
 	{
 		unique_lock<mutex> lck(write_buffers_lock);
 		auto lookup_result = write_buffers.find(write_buffer_idx);
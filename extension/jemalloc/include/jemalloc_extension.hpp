@@ -27,6 +27,7 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	static void SetThreadNode(idx_t node);
 };
 
 } // namespace duckdb
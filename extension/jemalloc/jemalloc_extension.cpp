@@ -102,6 +102,21 @@ void JemallocExtension::SetBackgroundThreads(bool enable) {
 	SetJemallocCTL("background_thread", enable);
 }
 
+void JemallocExtension::SetThreadNode(idx_t node) {
+	// Every node gets its own arena, so the memory of the threads of a node is not interleaved with that of others
+	static mutex node_arenas_lock;
+	static vector<unsigned> node_arenas;
+	unsigned arena_idx;
+	{
+		lock_guard<mutex> guard(node_arenas_lock);
+		while (node_arenas.size() <= node) {
+			node_arenas.push_back(GetJemallocCTL<unsigned>("arenas.create"));
+		}
+		arena_idx = node_arenas[node];
+	}
+	SetJemallocCTL("thread.arena", arena_idx);
+}
+
 std::string JemallocExtension::Version() const {
 #ifdef EXT_VERSION_JEMALLOC
 	return EXT_VERSION_JEMALLOC;
@@ -147,12 +147,63 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
+	if (!page_locations.empty()) {
+		// we only read the pages that can contain matching rows - only prefetch those
+		for (auto &range : page_prefetch_ranges) {
+			transport.RegisterPrefetch(range.first, range.second, allow_merge);
+		}
+		return;
+	}
 	if (chunk) {
 		uint64_t size = chunk->meta_data.total_compressed_size;
 		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
 	}
 }
 
+void ColumnReader::SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p,
+                                    const vector<ParquetRowRange> &row_ranges) {
+	D_ASSERT(!HasRepeats());
+	page_locations = std::move(page_locations_p);
+	page_prefetch_ranges.clear();
+	if (page_locations.empty()) {
+		return;
+	}
+	// the dictionary page (if any) precedes the data pages, and is always read
+	const auto chunk_start = FileOffset();
+	const auto first_data_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (chunk_start < first_data_page_offset) {
+		page_prefetch_ranges.emplace_back(chunk_start, first_data_page_offset - chunk_start);
+	}
+	// followed by the data pages that overlap with the row ranges (which are sorted and do not overlap)
+	const auto group_rows = NumericCast<idx_t>(chunk->meta_data.num_values);
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &page = page_locations[page_idx];
+		const auto page_start = NumericCast<idx_t>(page.first_row_index);
+		const auto page_end = page_idx + 1 < page_locations.size()
+		                          ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                          : group_rows;
+		while (range_idx < row_ranges.size() && row_ranges[range_idx].end <= page_start) {
+			range_idx++;
+		}
+		if (range_idx == row_ranges.size()) {
+			break;
+		}
+		if (row_ranges[range_idx].start >= page_end) {
+			// the page is skipped
+			continue;
+		}
+		const auto offset = NumericCast<idx_t>(page.offset);
+		const auto size = NumericCast<idx_t>(page.compressed_page_size);
+		if (!page_prefetch_ranges.empty() &&
+		    page_prefetch_ranges.back().first + page_prefetch_ranges.back().second == offset) {
+			page_prefetch_ranges.back().second += size;
+		} else {
+			page_prefetch_ranges.emplace_back(offset, size);
+		}
+	}
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -238,6 +289,10 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	pending_skips = 0;
+	page_locations.clear();
+	page_prefetch_ranges.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -598,9 +653,52 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (page_locations.empty()) {
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	const auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	const auto target_row = current_row + num_values;
+
+	// find the last page that starts at or before the target row
+	auto entry = std::upper_bound(page_locations.begin(), page_locations.end(), target_row,
+	                              [](idx_t row, const duckdb_parquet::format::PageLocation &location) {
+		                              return row < NumericCast<idx_t>(location.first_row_index);
+	                              });
+	if (entry == page_locations.begin()) {
+		return 0;
+	}
+	auto &target_page = *(entry - 1);
+	const auto target_page_start = NumericCast<idx_t>(target_page.first_row_index);
+	if (target_page_start <= current_row) {
+		// the target row is in the current page
+		return 0;
+	}
+	// the dictionary page (if any) has to be read before we can jump over any data pages
+	const auto first_data_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	while (trans.GetLocation() < first_data_page_offset) {
+		PrepareRead(none_filter);
+	}
+
+	// move to the start of the target page
+	chunk_read_offset = NumericCast<idx_t>(target_page.offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	const auto skipped = target_page_start - current_row;
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// jump over entire pages if we can
+	num_values -= SkipPages(num_values);
+	if (num_values == 0) {
+		return;
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1,8 +1,12 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
+#include "parquet_dlba_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_writer.hpp"
 #include "geo_parquet.hpp"
 #ifndef DUCKDB_AMALGAMATION
@@ -88,6 +92,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -327,13 +334,21 @@ struct PageInformation {
 	idx_t offset = 0;
 	idx_t row_count = 0;
 	idx_t empty_count = 0;
+	idx_t null_count = 0;
 	idx_t estimated_page_size = 0;
+
+	//! The number of (non-NULL) values in the page
+	idx_t ValueCount() const {
+		return row_count - empty_count - null_count;
+	}
 };
 
 struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the values in this page, these are merged into the column chunk statistics on flush
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -356,6 +371,13 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+
+	//! The min/max values of every data page, written as the ColumnIndex of the column chunk
+	duckdb_parquet::format::ColumnIndex column_index;
+	//! Whether or not all non-NULL pages had statistics (otherwise we cannot write a ColumnIndex)
+	bool has_column_index = true;
+	//! The Bloom filter of the column chunk (if any)
+	unique_ptr<BloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -374,6 +396,9 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	//! The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! Pages of non-repeated columns hold at most this many rows, so that readers can use the page index to skip
+	//! parts of a row group
+	static constexpr const idx_t MAX_ROWS_PER_PAGE = 20000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -401,12 +426,15 @@ protected:
 
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
+	//! Adds the statistics of a flushed page to the column index
+	void UpdateColumnIndex(BasicColumnWriterState &state, const PageInformation &page_info,
+	                       ColumnWriterStatistics &page_stats);
 
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
 	//! Initialize the writer for a specific page. Only used for scalar types.
-	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state);
+	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx);
 
 	//! Flushes the writer for a specific page. Only used for scalar types.
 	virtual void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state);
@@ -417,6 +445,14 @@ protected:
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
 
+	//! Whether or not a Bloom filter is written for this column
+	virtual bool HasBloomFilter() {
+		return false;
+	}
+	//! Inserts the (non-NULL) values of a (subset of a) vector into the Bloom filter. Only used for columns with a
+	//! Bloom filter that are not dictionary encoded - otherwise the dictionary is inserted when it is flushed
+	virtual void UpdateBloomFilter(BloomFilter &bloom_filter, Vector &vector, idx_t chunk_start, idx_t chunk_end);
+
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
 	}
@@ -445,7 +481,8 @@ void BasicColumnWriter::RegisterToRowGroup(duckdb_parquet::format::RowGroup &row
 	row_group.columns.push_back(std::move(column_chunk));
 }
 
-unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state) {
+unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state,
+                                                                         idx_t page_idx) {
 	return nullptr;
 }
 
@@ -475,14 +512,17 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-				page_info_ref = state.page_info.back();
-			}
+		} else {
+			page_info.null_count++;
 		}
 		vector_index++;
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+		    (max_repeat == 0 && page_info.row_count >= MAX_ROWS_PER_PAGE)) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
+			page_info_ref = state.page_info.back();
+		}
 	}
 }
 
@@ -519,7 +559,8 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		    MaxValue<idx_t>(NextPowerOfTwo(page_info.estimated_page_size), MemoryStream::DEFAULT_INITIAL_CAPACITY));
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
-		write_info.page_state = InitializePageState(state);
+		write_info.page_state = InitializePageState(state, page_idx);
+		write_info.page_stats = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -527,6 +568,22 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		state.write_info.push_back(std::move(write_info));
 	}
 
+	if (HasBloomFilter() && writer.WritesBloomFilters()) {
+		// the filter is sized for the number of distinct values - without a dictionary we can only use an upper bound
+		idx_t distinct_values = 0;
+		if (HasDictionary(state)) {
+			distinct_values = DictionarySize(state);
+		} else {
+			for (auto &page_info : state.page_info) {
+				distinct_values += page_info.ValueCount();
+			}
+		}
+		if (distinct_values > 0) {
+			state.bloom_filter = make_uniq<BloomFilter>(
+			    BloomFilter::OptimalSize(distinct_values, writer.BloomFilterFalsePositiveRatio()));
+		}
+	}
+
 	// start writing the first page
 	NextPage(state);
 }
@@ -590,6 +647,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	UpdateColumnIndex(state, state.page_info[state.current_page - 1], *write_info.page_stats);
+	state.stats_state->Merge(*write_info.page_stats);
+	write_info.page_stats.reset();
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -611,6 +671,27 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	}
 }
 
+void BasicColumnWriter::UpdateColumnIndex(BasicColumnWriterState &state, const PageInformation &page_info,
+                                          ColumnWriterStatistics &page_stats) {
+	if (!state.has_column_index) {
+		return;
+	}
+	auto &column_index = state.column_index;
+	const auto null_page = page_info.ValueCount() == 0;
+	if (!null_page && !page_stats.HasStats()) {
+		// we can only write a column index if we have the min/max of every page
+		state.has_column_index = false;
+		column_index = duckdb_parquet::format::ColumnIndex();
+		return;
+	}
+	column_index.null_pages.push_back(null_page);
+	// null pages have empty min/max values
+	column_index.min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+	column_index.max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+	column_index.null_counts.push_back(NumericCast<int64_t>(page_info.null_count));
+	column_index.__isset.null_counts = true;
+}
+
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
 	return make_uniq<ColumnWriterStatistics>();
 }
@@ -634,8 +715,11 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.page_stats.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (state.bloom_filter && !HasDictionary(state)) {
+			UpdateBloomFilter(*state.bloom_filter, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -710,12 +794,13 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
 	for (auto &write_info : state.write_info) {
+		const auto is_data_page = write_info.page_header.type == PageType::DATA_PAGE ||
+		                          write_info.page_header.type == PageType::DATA_PAGE_V2;
 		// set the data page offset whenever we see the *first* data page
-		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
-		                                                     write_info.page_header.type == PageType::DATA_PAGE_V2)) {
+		if (column_chunk.meta_data.data_page_offset == 0 && is_data_page) {
 			column_chunk.meta_data.data_page_offset = column_writer.GetTotalWritten();
-			;
 		}
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -724,9 +809,33 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (is_data_page) {
+			// the offset index stores the location of every data page, and the index of its first row
+			auto &page_info = state.page_info[offset_index.page_locations.size()];
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = NumericCast<int64_t>(page_info.offset);
+			offset_index.page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	// the page index is only written for non-repeated columns, as only there every page starts at a new row
+	if (max_repeat == 0 && !offset_index.page_locations.empty()) {
+		unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+		if (state.has_column_index) {
+			D_ASSERT(state.column_index.null_pages.size() == offset_index.page_locations.size());
+			column_index = make_uniq<duckdb_parquet::format::ColumnIndex>(std::move(state.column_index));
+		}
+		writer.SetPageIndex(state.col_idx, std::move(column_index), std::move(offset_index));
+	}
+	if (state.bloom_filter) {
+		writer.SetBloomFilter(state.col_idx, std::move(state.bloom_filter));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -737,6 +846,11 @@ idx_t BasicColumnWriter::DictionarySize(BasicColumnWriterState &state) {
 	throw InternalException("This page does not have a dictionary");
 }
 
+void BasicColumnWriter::UpdateBloomFilter(BloomFilter &bloom_filter, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+	throw InternalException("This column does not have a Bloom filter");
+}
+
 void BasicColumnWriter::WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer,
                                         idx_t row_count) {
 	D_ASSERT(temp_writer);
@@ -796,6 +910,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -899,6 +1022,64 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 	ser.WriteData(const_data_ptr_cast(write_combiner), write_combiner_count * sizeof(TGT));
 }
 
+template <class SRC, class TGT, class OP = ParquetCastOperator>
+static void TemplatedWriteDeltaBinaryPacked(Vector &col, ColumnWriterStatistics *stats, const idx_t chunk_start,
+                                            const idx_t chunk_end, ValidityMask &mask, DbpEncoder &encoder,
+                                            WriteStream &ser) {
+	const auto *ptr = FlatVector::GetData<SRC>(col);
+	for (idx_t r = chunk_start; r < chunk_end; r++) {
+		if (!mask.RowIsValid(r)) {
+			continue;
+		}
+		TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+		OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+		encoder.WriteValue(ser, static_cast<int64_t>(target_value));
+	}
+}
+
+template <class SRC, class TGT, class OP = ParquetCastOperator>
+static void TemplatedWriteByteStreamSplit(Vector &col, ColumnWriterStatistics *stats, const idx_t chunk_start,
+                                          const idx_t chunk_end, ValidityMask &mask, BssEncoder<TGT> &encoder) {
+	const auto *ptr = FlatVector::GetData<SRC>(col);
+	for (idx_t r = chunk_start; r < chunk_end; r++) {
+		if (!mask.RowIsValid(r)) {
+			continue;
+		}
+		TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+		OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+		encoder.WriteValue(target_value);
+	}
+}
+
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx,
+	                          duckdb_parquet::format::Encoding::type encoding, bool is_32_bit)
+	    : BasicColumnWriterState(row_group, col_idx), encoding(encoding), dbp_analyzer(is_32_bit) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	//! The encoding of the data pages of this column chunk
+	duckdb_parquet::format::Encoding::type encoding;
+
+	// analysis state
+	idx_t value_count = 0;
+	DbpAnalyzer dbp_analyzer;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(duckdb_parquet::format::Encoding::type encoding, idx_t value_count, bool is_32_bit)
+	    : encoding(encoding), dbp_encoder(value_count, is_32_bit),
+	      bss_encoder(encoding == Encoding::BYTE_STREAM_SPLIT ? value_count : 0) {
+	}
+
+	duckdb_parquet::format::Encoding::type encoding;
+	DbpEncoder dbp_encoder;
+	BssEncoder<TGT> bss_encoder;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -909,19 +1090,140 @@ public:
 	~StandardColumnWriter() override = default;
 
 public:
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result =
+		    make_uniq<StandardColumnWriterState>(row_group, row_group.columns.size(), InitialEncoding(), Is32Bit());
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		// we only need to analyze the data if we need to choose between PLAIN and DELTA_BINARY_PACKED
+		return !writer.HasForcedEncoding() && writer.GetParquetVersion() == ParquetVersion::V2 && SupportsDelta();
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto data = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(data[vector_index]);
+				state.dbp_analyzer.Update(static_cast<int64_t>(target_value));
+				state.value_count++;
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		// use DELTA_BINARY_PACKED only if it is estimated to be smaller than PLAIN
+		auto plain_size = state.value_count * sizeof(TGT);
+		if (state.dbp_analyzer.GetEstimatedSize() < plain_size) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
 	unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		if (state.encoding == Encoding::PLAIN) {
+			return nullptr;
+		}
+		auto &page_info = state.page_info[page_idx];
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding, page_info.ValueCount(), Is32Bit());
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		if (!state_p) {
+			return;
+		}
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED:
+			page_state.dbp_encoder.FinishWrite(temp_writer);
+			break;
+		case Encoding::BYTE_STREAM_SPLIT:
+			page_state.bss_encoder.FinishWrite(temp_writer);
+			break;
+		default:
+			throw InternalException("Unsupported encoding for StandardColumnWriter");
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return state.encoding;
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state_p) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED:
+			TemplatedWriteDeltaBinaryPacked<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask,
+			                                              page_state.dbp_encoder, temp_writer);
+			break;
+		case Encoding::BYTE_STREAM_SPLIT:
+			TemplatedWriteByteStreamSplit<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask,
+			                                            page_state.bss_encoder);
+			break;
+		default:
+			throw InternalException("Unsupported encoding for StandardColumnWriter");
+		}
 	}
 
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
+
+private:
+	bool Is32Bit() const {
+		return writer.GetType(schema_idx) == Type::INT32;
+	}
+	bool SupportsDelta() const {
+		auto type = writer.GetType(schema_idx);
+		return type == Type::INT32 || type == Type::INT64;
+	}
+	bool SupportsByteStreamSplit() const {
+		auto type = writer.GetType(schema_idx);
+		return type == Type::FLOAT || type == Type::DOUBLE;
+	}
+
+	//! The encoding of a column chunk before analysis (if any)
+	duckdb_parquet::format::Encoding::type InitialEncoding() const {
+		if (writer.HasForcedEncoding()) {
+			auto encoding = writer.GetForcedEncoding();
+			if ((encoding == Encoding::DELTA_BINARY_PACKED && SupportsDelta()) ||
+			    (encoding == Encoding::BYTE_STREAM_SPLIT && SupportsByteStreamSplit())) {
+				return encoding;
+			}
+			// the encoding is not supported for this type - fallback to PLAIN
+			return Encoding::PLAIN;
+		}
+		if (writer.GetParquetVersion() == ParquetVersion::V2 && SupportsByteStreamSplit() &&
+		    writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values does not make the data smaller by itself,
+			// but it makes the data compress much better
+			return Encoding::BYTE_STREAM_SPLIT;
+		}
+		return Encoding::PLAIN;
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -952,6 +1254,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1000,7 +1307,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<BooleanWriterPageState>();
 	}
 
@@ -1083,6 +1390,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1161,6 +1475,24 @@ public:
 		}
 	}
 
+	bool HasBloomFilter() override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BloomFilter &bloom_filter, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<hugeint_t>(input_column);
+
+		data_t temp_buffer[PARQUET_UUID_SIZE];
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetUUID(ptr[r], temp_buffer);
+				bloom_filter.Insert(ParquetStatisticsUtils::BloomFilterHash(temp_buffer, PARQUET_UUID_SIZE));
+			}
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return PARQUET_UUID_SIZE;
 	}
@@ -1306,6 +1638,23 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (values_too_big) {
+			return;
+		}
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1322,8 +1671,8 @@ public:
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
-	// key_bit_width== 0 signifies the chunk is written in plain encoding
-	uint32_t key_bit_width;
+	// key_bit_width== 0 signifies the chunk is written in plain (or delta length) encoding
+	uint32_t key_bit_width = 0;
 
 	bool IsDictionaryEncoded() const {
 		return key_bit_width != 0;
@@ -1340,11 +1689,13 @@ public:
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	// if 0, we're writing a plain (or delta length) page
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	// only set if we're writing a DELTA_LENGTH_BYTE_ARRAY page
+	unique_ptr<DlbaEncoder> dlba_encoder;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1367,7 +1718,8 @@ public:
 	}
 
 	bool HasAnalyze() override {
-		return true;
+		// forcing an encoding disables the dictionary
+		return !writer.HasForcedEncoding() || !SupportsForcedEncoding();
 	}
 
 	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
@@ -1448,6 +1800,7 @@ public:
 				if (!mask.RowIsValid(r)) {
 					continue;
 				}
+				stats.Update(ptr[r]);
 				auto value_index = page_state.dictionary.at(ptr[r]);
 				if (!page_state.written_value) {
 					// first value
@@ -1460,6 +1813,15 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.dlba_encoder) {
+			// delta length page
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				page_state.dlba_encoder->WriteValue(temp_writer, ptr[r]);
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1473,13 +1835,38 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+	bool HasBloomFilter() override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BloomFilter &bloom_filter, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				bloom_filter.Insert(
+				    ParquetStatisticsUtils::BloomFilterHash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		auto result = make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		if (GetEncoding(state) == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+			auto &page_info = state.page_info[page_idx];
+			result->dlba_encoder = make_uniq<DlbaEncoder>(page_info.ValueCount(), page_info.estimated_page_size);
+		}
+		return std::move(result);
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<StringWriterPageState>();
+		if (page_state.dlba_encoder) {
+			page_state.dlba_encoder->FinishWrite(temp_writer);
+			return;
+		}
 		if (page_state.bit_width != 0) {
 			if (!page_state.written_value) {
 				// all values are null
@@ -1493,7 +1880,13 @@ public:
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		if (writer.HasForcedEncoding() && SupportsForcedEncoding()) {
+			return writer.GetForcedEncoding();
+		}
+		return writer.GetParquetVersion() == ParquetVersion::V2 ? Encoding::DELTA_LENGTH_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1526,6 +1919,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->Insert(
+				    ParquetStatisticsUtils::BloomFilterHash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -1545,6 +1942,11 @@ public:
 	}
 
 private:
+	bool SupportsForcedEncoding() const {
+		auto encoding = writer.GetForcedEncoding();
+		return encoding == Encoding::PLAIN || encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY;
+	}
+
 	bool WontUseDictionary(StringColumnWriterState &state) const {
 		return state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		       DictionaryCompressionRatio(state) < writer.DictionaryCompressionRatioThreshold();
@@ -1631,7 +2033,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<EnumWriterPageState>(bit_width);
 	}
 
@@ -26,6 +26,7 @@
 
 namespace duckdb {
 class ParquetReader;
+struct ParquetRowRange;
 
 using duckdb_apache::thrift::protocol::TProtocol;
 
@@ -68,6 +69,12 @@ public:
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
+	//! Sets the page locations (from the offset index) of the current column chunk. This allows skips to jump over
+	//! entire pages without reading them, and only the pages that overlap with "row_ranges" are prefetched. Only valid
+	//! for non-repeated columns, and reset by InitializeRead
+	virtual void SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations,
+	                              const vector<ParquetRowRange> &row_ranges);
+
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
 	template <class VALUE_TYPE, class CONVERSION>
@@ -166,6 +173,8 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Skips (up to) the given number of values by jumping over entire pages, returns the number of values skipped
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -175,6 +184,10 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The locations of the data pages of the current column chunk, if known
+	vector<duckdb_parquet::format::PageLocation> page_locations;
+	//! The byte ranges (offset, length) of the pages that are read if the page locations are known
+	vector<pair<idx_t, idx_t>> page_prefetch_ranges;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -47,6 +47,11 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations,
+	                      const vector<ParquetRowRange> &row_ranges) override {
+		child_reader->SetPageLocations(std::move(page_locations), row_ranges);
+	}
 };
 
 } // namespace duckdb
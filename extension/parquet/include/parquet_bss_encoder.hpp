@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the BYTE_STREAM_SPLIT encoding
+//! The K-th byte of every value is written to the K-th stream, the streams are concatenated
+template <class T>
+class BssEncoder {
+public:
+	explicit BssEncoder(idx_t total_value_count_p)
+	    : total_value_count(total_value_count_p), count(0),
+	      buffer(make_unsafe_uniq_array<data_t>(total_value_count * sizeof(T))) {
+	}
+
+public:
+	void WriteValue(const T &value) {
+		D_ASSERT(count < total_value_count);
+		auto source = const_data_ptr_cast(&value);
+		for (idx_t byte_idx = 0; byte_idx < sizeof(T); byte_idx++) {
+			buffer[byte_idx * total_value_count + count] = source[byte_idx];
+		}
+		count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		if (count != total_value_count) {
+			throw InternalException("BssEncoder: expected %llu values but got %llu", total_value_count, count);
+		}
+		writer.WriteData(buffer.get(), total_value_count * sizeof(T));
+	}
+
+private:
+	idx_t total_value_count;
+	idx_t count;
+	//! The byte streams, every stream holds "total_value_count" bytes
+	unsafe_unique_array<data_t> buffer;
+};
+
+} // namespace duckdb
@@ -0,0 +1,249 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding
+//! <block size in values> <number of miniblocks in a block> <total value count> <first value>, followed by blocks of
+//! <min delta> <bit width of each miniblock> <miniblocks>. Every miniblock holds the bitpacked (delta - min delta)
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS_IN_A_BLOCK = 4;
+	static constexpr const idx_t NUMBER_OF_VALUES_IN_A_MINIBLOCK =
+	    BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+
+public:
+	//! "total_value_count" is the exact number of values that will be written (it is part of the header).
+	//! For 32-bit physical types the deltas are computed modulo 2^32, so the bit width never exceeds 32
+	DbpEncoder(idx_t total_value_count_p, bool is_32_bit_p)
+	    : total_value_count(total_value_count_p), is_32_bit(is_32_bit_p), count(0), previous_value(0),
+	      min_delta(NumericLimits<int64_t>::Maximum()), block_count(0) {
+	}
+
+public:
+	void WriteValue(WriteStream &writer, int64_t value) {
+		if (count == 0) {
+			// the first value is stored in the header
+			WriteHeader(writer, value);
+		} else {
+			auto delta = Delta(value, previous_value);
+			min_delta = MinValue(min_delta, delta);
+			deltas[block_count++] = delta;
+			if (block_count == BLOCK_SIZE_IN_VALUES) {
+				WriteBlock(writer);
+			}
+		}
+		previous_value = value;
+		count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		if (count != total_value_count) {
+			throw InternalException("DbpEncoder: expected %llu values but got %llu", total_value_count, count);
+		}
+		if (count == 0) {
+			// no values at all - we still need a header
+			WriteHeader(writer, 0);
+			return;
+		}
+		if (block_count != 0) {
+			WriteBlock(writer);
+		}
+	}
+
+	//! Computes the delta between two values (with wraparound in the domain of the physical type)
+	static int64_t Delta(int64_t value, int64_t previous_value, bool is_32_bit) {
+		auto delta = static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(previous_value));
+		if (is_32_bit) {
+			delta = static_cast<int32_t>(static_cast<uint32_t>(delta));
+		}
+		return delta;
+	}
+
+	//! Computes the number of bits required to store (max delta - min delta)
+	static uint8_t ComputeBitWidth(int64_t min_delta, int64_t max_delta, bool is_32_bit) {
+		auto range = static_cast<uint64_t>(max_delta) - static_cast<uint64_t>(min_delta);
+		if (is_32_bit) {
+			range = static_cast<uint32_t>(range);
+		}
+		uint8_t width = 0;
+		while (range != 0) {
+			range >>= 1;
+			width++;
+		}
+		return width;
+	}
+
+	//! Estimates the size of a block of "count" deltas with the given min/max delta, used to choose an encoding
+	static idx_t EstimateBlockSize(idx_t count, int64_t min_delta, int64_t max_delta, bool is_32_bit) {
+		const auto bit_width = ComputeBitWidth(min_delta, max_delta, is_32_bit);
+		const auto miniblock_count = (count + NUMBER_OF_VALUES_IN_A_MINIBLOCK - 1) / NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+		return GetVarintSize(IntToZigzag(min_delta)) + NUMBER_OF_MINIBLOCKS_IN_A_BLOCK +
+		       miniblock_count * NUMBER_OF_VALUES_IN_A_MINIBLOCK * bit_width / 8;
+	}
+
+private:
+	int64_t Delta(int64_t value, int64_t previous) const {
+		return Delta(value, previous, is_32_bit);
+	}
+
+	void WriteHeader(WriteStream &writer, int64_t first_value) {
+		VarintEncode(BLOCK_SIZE_IN_VALUES, writer);
+		VarintEncode(NUMBER_OF_MINIBLOCKS_IN_A_BLOCK, writer);
+		VarintEncode(total_value_count, writer);
+		VarintEncode(IntToZigzag(first_value), writer);
+	}
+
+	void WriteBlock(WriteStream &writer) {
+		D_ASSERT(block_count > 0);
+		// the last miniblock is padded with zeroes
+		for (idx_t i = block_count; i < BLOCK_SIZE_IN_VALUES; i++) {
+			deltas[i] = min_delta;
+		}
+		// compute the bit width of every miniblock
+		uint8_t bit_widths[NUMBER_OF_MINIBLOCKS_IN_A_BLOCK];
+		const auto miniblock_count =
+		    (block_count + NUMBER_OF_VALUES_IN_A_MINIBLOCK - 1) / NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+			if (miniblock_idx >= miniblock_count) {
+				// unused miniblocks have no data, their bit width is irrelevant
+				bit_widths[miniblock_idx] = 0;
+				continue;
+			}
+			auto max_delta = min_delta;
+			for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+				max_delta = MaxValue(max_delta, deltas[miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK + i]);
+			}
+			bit_widths[miniblock_idx] = ComputeBitWidth(min_delta, max_delta, is_32_bit);
+		}
+
+		// <min delta> <list of bitwidths of miniblocks> <miniblocks>
+		VarintEncode(IntToZigzag(min_delta), writer);
+		writer.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS_IN_A_BLOCK);
+		for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+			BitPackMiniblock(writer, deltas + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK,
+			                 bit_widths[miniblock_idx]);
+		}
+
+		min_delta = NumericLimits<int64_t>::Maximum();
+		block_count = 0;
+	}
+
+	void BitPackMiniblock(WriteStream &writer, const int64_t *miniblock_deltas, uint8_t bit_width) {
+		if (bit_width == 0) {
+			return;
+		}
+		data_t packed[NUMBER_OF_VALUES_IN_A_MINIBLOCK * sizeof(uint64_t)];
+		memset(packed, 0, sizeof(packed));
+		idx_t bit_pos = 0;
+		for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+			auto value = static_cast<uint64_t>(miniblock_deltas[i]) - static_cast<uint64_t>(min_delta);
+			// values are packed starting at the least significant bit
+			for (idx_t bit = 0; bit < bit_width;) {
+				const auto bit_offset = bit_pos % 8;
+				const auto bits = MinValue<idx_t>(bit_width - bit, 8 - bit_offset);
+				packed[bit_pos / 8] |= static_cast<data_t>(((value >> bit) & ((1ULL << bits) - 1)) << bit_offset);
+				bit += bits;
+				bit_pos += bits;
+			}
+		}
+		writer.WriteData(packed, NUMBER_OF_VALUES_IN_A_MINIBLOCK * bit_width / 8);
+	}
+
+	static uint64_t IntToZigzag(int64_t value) {
+		return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+	}
+
+	static void VarintEncode(uint64_t value, WriteStream &writer) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+
+	static idx_t GetVarintSize(uint64_t value) {
+		idx_t result = 0;
+		do {
+			value >>= 7;
+			result++;
+		} while (value != 0);
+		return result;
+	}
+
+private:
+	idx_t total_value_count;
+	bool is_32_bit;
+	idx_t count;
+	int64_t previous_value;
+
+	//! The deltas of the current block
+	int64_t deltas[BLOCK_SIZE_IN_VALUES];
+	int64_t min_delta;
+	idx_t block_count;
+};
+
+//! Estimates the size of a sequence of values when written with DELTA_BINARY_PACKED
+class DbpAnalyzer {
+public:
+	explicit DbpAnalyzer(bool is_32_bit_p)
+	    : is_32_bit(is_32_bit_p), count(0), previous_value(0), min_delta(NumericLimits<int64_t>::Maximum()),
+	      max_delta(NumericLimits<int64_t>::Minimum()), block_count(0), estimated_size(0) {
+	}
+
+public:
+	void Update(int64_t value) {
+		if (count++ != 0) {
+			auto delta = DbpEncoder::Delta(value, previous_value, is_32_bit);
+			min_delta = MinValue(min_delta, delta);
+			max_delta = MaxValue(max_delta, delta);
+			if (++block_count == DbpEncoder::BLOCK_SIZE_IN_VALUES) {
+				FinishBlock();
+			}
+		}
+		previous_value = value;
+	}
+
+	idx_t GetEstimatedSize() {
+		if (block_count != 0) {
+			FinishBlock();
+		}
+		// the header takes at most 4 varints
+		return estimated_size + 4 * sizeof(uint64_t);
+	}
+
+private:
+	void FinishBlock() {
+		estimated_size += DbpEncoder::EstimateBlockSize(block_count, min_delta, max_delta, is_32_bit);
+		min_delta = NumericLimits<int64_t>::Maximum();
+		max_delta = NumericLimits<int64_t>::Minimum();
+		block_count = 0;
+	}
+
+private:
+	bool is_32_bit;
+	idx_t count;
+	int64_t previous_value;
+	int64_t min_delta;
+	int64_t max_delta;
+	idx_t block_count;
+	idx_t estimated_size;
+};
+
+} // namespace duckdb
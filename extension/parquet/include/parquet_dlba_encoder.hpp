@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dlba_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "parquet_dbp_encoder.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/memory_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_LENGTH_BYTE_ARRAY encoding
+//! The lengths of all strings (encoded with DELTA_BINARY_PACKED), followed by the concatenated string data
+class DlbaEncoder {
+public:
+	DlbaEncoder(idx_t total_value_count, idx_t total_string_size)
+	    : length_encoder(total_value_count, true),
+	      string_data(MaxValue<idx_t>(NextPowerOfTwo(total_string_size), MemoryStream::DEFAULT_INITIAL_CAPACITY)) {
+	}
+
+public:
+	void WriteValue(WriteStream &writer, const string_t &value) {
+		length_encoder.WriteValue(writer, UnsafeNumericCast<int64_t>(value.GetSize()));
+		string_data.WriteData(const_data_ptr_cast(value.GetData()), value.GetSize());
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		length_encoder.FinishWrite(writer);
+		writer.WriteData(string_data.GetData(), string_data.GetPosition());
+	}
+
+private:
+	DbpEncoder length_encoder;
+	//! The string data is buffered until all lengths have been written
+	MemoryStream string_data;
+};
+
+} // namespace duckdb
@@ -48,6 +48,12 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -64,6 +70,11 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The ranges of rows in the current row group that can pass the filters according to the page index. Rows
+	//! outside of these ranges are skipped. Empty if the page index could not be used to prune the row group
+	vector<ParquetRowRange> row_ranges;
+	idx_t current_row_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -174,6 +185,9 @@ public:
 
 	unique_ptr<BaseStatistics> ReadStatistics(const string &name);
 	static LogicalType DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string);
+	//! Returns for every row group whether the Bloom filter of the column proves that no row passes the filter, i.e.,
+	//! whether a scan with this filter skips the row group because of the Bloom filter (used by parquet_bloom_probe)
+	vector<bool> BloomFilterExcludesRowGroups(ClientContext &context, idx_t col_idx, const TableFilter &filter);
 
 	FileHandle &GetHandle() {
 		return *file_handle;
@@ -209,6 +223,10 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Reads the Bloom filter of the column chunk (if any), returns true if it proves that no row passes the filter
+	bool BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &reader, const TableFilter &filter);
+	//! Uses the page index of the filtered columns to determine which rows of the current row group can be skipped
+	void PrepareRowRanges(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
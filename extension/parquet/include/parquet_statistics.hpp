@@ -12,15 +12,29 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
+class BloomFilter;
 class ColumnReader;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the given Parquet statistics (e.g., of a single page) of a non-nested column
+	static unique_ptr<BaseStatistics>
+	TransformColumnStatistics(const ColumnReader &reader, const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not Bloom filters are written for (and read from) columns of the given type
+	static bool BloomFilterSupported(const LogicalTypeId &type_id);
+	//! Hashes a plain-encoded value (without the length prefix of BYTE_ARRAY values) for a Parquet Bloom filter
+	static hash_t BloomFilterHash(const_data_ptr_t data, idx_t size);
+	//! Whether or not the filter can be checked against a Bloom filter, i.e., if it consists of equality comparisons
+	static bool BloomFilterApplies(const TableFilter &filter);
+	//! Returns true if the Bloom filter proves that none of the values in the column chunk can pass the filter
+	static bool BloomFilterExcludes(const TableFilter &filter, const BloomFilter &bloom_filter);
 };
 
 } // namespace duckdb
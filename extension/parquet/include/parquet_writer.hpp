@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bloom_filter.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
@@ -32,6 +33,17 @@ class ParquetEncryptionConfig;
 class Serializer;
 class Deserializer;
 
+//! The version of the Parquet format that is written, V2 enables the newer data page encodings
+enum class ParquetVersion : uint8_t { V1 = 1, V2 = 2 };
+
+//! The page index (ColumnIndex + OffsetIndex) of a single column chunk
+struct ParquetPageIndex {
+	//! The min/max values of every page - not present if not all pages had statistics
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	//! The locations of every page
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<unique_ptr<ColumnWriterState>> states;
@@ -67,7 +79,8 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, ParquetVersion parquet_version,
+	              optional_idx encoding, double bloom_filter_false_positive_ratio);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,11 +116,35 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
+	//! Whether or not the data page encoding was set explicitly (using the ENCODING option)
+	bool HasForcedEncoding() const {
+		return encoding.IsValid();
+	}
+	duckdb_parquet::format::Encoding::type GetForcedEncoding() const {
+		D_ASSERT(HasForcedEncoding());
+		return static_cast<duckdb_parquet::format::Encoding::type>(encoding.GetIndex());
+	}
+	//! Whether or not Bloom filters are written. They are not encrypted, so they are not written for encrypted files
+	bool WritesBloomFilters() const {
+		return bloom_filter_false_positive_ratio > 0 && !encryption_config;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
 	}
 
+	//! Sets the page index of a column chunk of the row group that is currently being flushed
+	void SetPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  duckdb_parquet::format::OffsetIndex offset_index);
+	//! Sets the Bloom filter of a column chunk of the row group that is currently being flushed
+	void SetBloomFilter(idx_t column_idx, unique_ptr<BloomFilter> bloom_filter);
+
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
 
@@ -116,6 +153,12 @@ public:
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
+private:
+	//! Writes the page indexes of all row groups right before the footer
+	void WritePageIndexes();
+	//! Writes the Bloom filters of the row group that is being flushed right after its column chunks
+	void WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group);
+
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
@@ -126,6 +169,10 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	ParquetVersion parquet_version;
+	//! The encoding to use for all columns that support it, if set
+	optional_idx encoding;
+	double bloom_filter_false_positive_ratio;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +181,10 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes of all column chunks that were written (by row group, then by column)
+	vector<vector<unique_ptr<ParquetPageIndex>>> page_indexes;
+	//! The Bloom filters of the column chunks of the row group that is being flushed
+	vector<unique_ptr<BloomFilter>> bloom_filters;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
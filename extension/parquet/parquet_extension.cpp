@@ -201,6 +201,14 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The Parquet version, V2 lets the writer choose the newer (delta/byte stream split) encodings
+	ParquetVersion parquet_version = ParquetVersion::V1;
+	//! The encoding to use for the data pages, if not set the writer chooses one per column chunk
+	optional_idx encoding;
+	//! The target false positive ratio of the Bloom filters of string and UUID columns, 0 (the default) disables Bloom
+	//! filters
+	double bloom_filter_false_positive_ratio = 0;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -407,6 +415,8 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.bloom_filter_pushdown = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -1271,6 +1281,38 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected parquet_version to be either [V1, V2]");
+			}
+		} else if (loption == "encoding") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "PLAIN") {
+				bind_data->encoding = duckdb_parquet::format::Encoding::PLAIN;
+			} else if (roption == "DELTA_BINARY_PACKED") {
+				bind_data->encoding = duckdb_parquet::format::Encoding::DELTA_BINARY_PACKED;
+			} else if (roption == "DELTA_LENGTH_BYTE_ARRAY") {
+				bind_data->encoding = duckdb_parquet::format::Encoding::DELTA_LENGTH_BYTE_ARRAY;
+			} else if (roption == "BYTE_STREAM_SPLIT") {
+				bind_data->encoding = duckdb_parquet::format::Encoding::BYTE_STREAM_SPLIT;
+			} else {
+				throw BinderException("Expected encoding to be either [PLAIN, DELTA_BINARY_PACKED, "
+				                      "DELTA_LENGTH_BYTE_ARRAY, BYTE_STREAM_SPLIT]");
+			}
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val == -1) {
+				val = 0;
+			} else if (val < 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1, or 0 or -1 to "
+				                      "disable Bloom filters");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1300,7 +1342,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.parquet_version, parquet_bind.encoding,
+	                             parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -1424,6 +1468,12 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<uint8_t>(112, "parquet_version",
+	                                             static_cast<uint8_t>(bind_data.parquet_version),
+	                                             static_cast<uint8_t>(ParquetVersion::V1));
+	serializer.WritePropertyWithDefault<optional_idx>(113, "encoding", bind_data.encoding);
+	serializer.WritePropertyWithDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.0);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1443,6 +1493,11 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithDefault<bool>(111, "debug_use_openssl", true);
+	data->parquet_version = static_cast<ParquetVersion>(deserializer.ReadPropertyWithDefault<uint8_t>(
+	    112, "parquet_version", static_cast<uint8_t>(ParquetVersion::V1)));
+	deserializer.ReadPropertyWithDefault<optional_idx>(113, "encoding", data->encoding);
+	deserializer.ReadPropertyWithDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                             data->bloom_filter_false_positive_ratio, 0.0);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1644,6 +1699,14 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_bloom_probe
+	ParquetBloomProbeFunction bloom_probe_fun;
+	TableFunctionSet bloom_probe_set(bloom_probe_fun.name);
+	bloom_probe_set.AddFunction(bloom_probe_fun);
+	bloom_probe_fun.arguments[0] = LogicalType::LIST(LogicalType::VARCHAR);
+	bloom_probe_set.AddFunction(std::move(bloom_probe_fun));
+	ExtensionUtil::RegisterFunction(db_instance, bloom_probe_set);
+
 	CopyFunction function("parquet");
 	function.copy_to_select = ParquetWriteSelect;
 	function.copy_to_bind = ParquetWriteBind;
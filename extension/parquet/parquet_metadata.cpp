@@ -9,6 +9,8 @@
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #endif
 
 namespace duckdb {
@@ -17,9 +19,18 @@ struct ParquetMetaDataBindData : public TableFunctionData {
 	vector<LogicalType> return_types;
 	unique_ptr<MultiFileList> file_list;
 	unique_ptr<MultiFileReader> multi_file_reader;
+	//! The column and the value that are probed (parquet_bloom_probe only)
+	string probe_column_name;
+	Value probe_constant;
 };
 
-enum class ParquetMetadataOperatorType : uint8_t { META_DATA, SCHEMA, KEY_VALUE_META_DATA, FILE_META_DATA };
+enum class ParquetMetadataOperatorType : uint8_t {
+	META_DATA,
+	SCHEMA,
+	KEY_VALUE_META_DATA,
+	FILE_META_DATA,
+	BLOOM_PROBE
+};
 
 struct ParquetMetaDataOperatorData : public GlobalTableFunctionState {
 	explicit ParquetMetaDataOperatorData(ClientContext &context, const vector<LogicalType> &types)
@@ -37,11 +48,16 @@ public:
 	static void BindSchema(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindKeyValueMetaData(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindFileMetaData(vector<LogicalType> &return_types, vector<string> &names);
+	static void BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names);
 
 	void LoadRowGroupMetadata(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadSchemaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadKeyValueMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadFileMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
+	void LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path,
+	                    const string &column_name, const Value &probe_constant);
+	void LoadData(ClientContext &context, const ParquetMetaDataBindData &bind_data, ParquetMetadataOperatorType type,
+	              const string &file_path);
 };
 
 template <class T>
@@ -164,6 +180,12 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("key_value_metadata");
 	return_types.emplace_back(LogicalType::MAP(LogicalType::BLOB, LogicalType::BLOB));
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_length");
+	return_types.emplace_back(LogicalType::BIGINT);
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -298,6 +320,14 @@ void ParquetMetaDataOperatorData::LoadRowGroupMetadata(ClientContext &context, c
 			    23, count,
 			    Value::MAP(LogicalType::BLOB, LogicalType::BLOB, std::move(map_keys), std::move(map_values)));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    24, count, ParquetElementBigint(col_meta.bloom_filter_offset, col_meta.__isset.bloom_filter_offset));
+
+			// bloom_filter_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    25, count, ParquetElementBigint(col_meta.bloom_filter_length, col_meta.__isset.bloom_filter_length));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
@@ -560,6 +590,95 @@ void ParquetMetaDataOperatorData::LoadFileMetaData(ClientContext &context, const
 	collection.InitializeScan(scan_state);
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Probe
+//===--------------------------------------------------------------------===//
+void ParquetMetaDataOperatorData::BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("file_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_group_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_excludes");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+}
+
+void ParquetMetaDataOperatorData::LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types,
+                                                 const string &file_path, const string &column_name,
+                                                 const Value &probe_constant) {
+	collection.Reset();
+	ParquetOptions parquet_options(context);
+	auto reader = make_uniq<ParquetReader>(context, file_path, parquet_options);
+	idx_t col_idx;
+	for (col_idx = 0; col_idx < reader->names.size(); col_idx++) {
+		if (reader->names[col_idx] == column_name) {
+			break;
+		}
+	}
+	if (col_idx == reader->names.size()) {
+		throw InvalidInputException("Column \"%s\" not found in Parquet file \"%s\"", column_name, file_path);
+	}
+	// probe the Bloom filters the same way a scan with an equality filter on the column does - a list of values is
+	// probed like an IN-list, which is pushed into the scan as an OR of equality filters
+	auto &column_type = reader->return_types[col_idx];
+	unique_ptr<TableFilter> filter;
+	if (probe_constant.type().id() == LogicalTypeId::LIST) {
+		auto or_filter = make_uniq<ConjunctionOrFilter>();
+		for (auto &value : ListValue::GetChildren(probe_constant)) {
+			or_filter->child_filters.push_back(
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, value.DefaultCastAs(column_type)));
+		}
+		filter = std::move(or_filter);
+	} else {
+		filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, probe_constant.DefaultCastAs(column_type));
+	}
+	auto excludes = reader->BloomFilterExcludesRowGroups(context, col_idx, *filter);
+
+	DataChunk current_chunk;
+	current_chunk.Initialize(context, return_types);
+	idx_t count = 0;
+	for (idx_t row_group_idx = 0; row_group_idx < excludes.size(); row_group_idx++) {
+		current_chunk.SetValue(0, count, Value(file_path));
+		current_chunk.SetValue(1, count, Value::BIGINT(NumericCast<int64_t>(row_group_idx)));
+		current_chunk.SetValue(2, count, Value::BOOLEAN(excludes[row_group_idx]));
+		count++;
+		if (count >= STANDARD_VECTOR_SIZE) {
+			current_chunk.SetCardinality(count);
+			collection.Append(current_chunk);
+			count = 0;
+			current_chunk.Reset();
+		}
+	}
+	current_chunk.SetCardinality(count);
+	collection.Append(current_chunk);
+	collection.InitializeScan(scan_state);
+}
+
+void ParquetMetaDataOperatorData::LoadData(ClientContext &context, const ParquetMetaDataBindData &bind_data,
+                                           ParquetMetadataOperatorType type, const string &file_path) {
+	switch (type) {
+	case ParquetMetadataOperatorType::SCHEMA:
+		LoadSchemaData(context, bind_data.return_types, file_path);
+		break;
+	case ParquetMetadataOperatorType::META_DATA:
+		LoadRowGroupMetadata(context, bind_data.return_types, file_path);
+		break;
+	case ParquetMetadataOperatorType::KEY_VALUE_META_DATA:
+		LoadKeyValueMetaData(context, bind_data.return_types, file_path);
+		break;
+	case ParquetMetadataOperatorType::FILE_META_DATA:
+		LoadFileMetaData(context, bind_data.return_types, file_path);
+		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		LoadBloomProbe(context, bind_data.return_types, file_path, bind_data.probe_column_name,
+		               bind_data.probe_constant);
+		break;
+	default:
+		throw InternalException("Unsupported ParquetMetadataOperatorType");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Bind
 //===--------------------------------------------------------------------===//
@@ -579,12 +698,22 @@ unique_ptr<FunctionData> ParquetMetaDataBind(ClientContext &context, TableFuncti
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		ParquetMetaDataOperatorData::BindFileMetaData(return_types, names);
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		ParquetMetaDataOperatorData::BindBloomProbe(return_types, names);
+		break;
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
 
 	auto result = make_uniq<ParquetMetaDataBindData>();
 	result->return_types = return_types;
+	if (TYPE == ParquetMetadataOperatorType::BLOOM_PROBE) {
+		if (input.inputs[1].IsNull() || input.inputs[2].IsNull()) {
+			throw BinderException("parquet_bloom_probe: the column name and the probed value cannot be NULL");
+		}
+		result->probe_column_name = StringValue::Get(input.inputs[1]);
+		result->probe_constant = input.inputs[2];
+	}
 	result->multi_file_reader = MultiFileReader::Create(input.table_function);
 	result->file_list = result->multi_file_reader->CreateFileList(context, input.inputs[0]);
 	return std::move(result);
@@ -601,22 +730,7 @@ unique_ptr<GlobalTableFunctionState> ParquetMetaDataInit(ClientContext &context,
 
 	D_ASSERT(!bind_data.file_list->IsEmpty());
 
-	switch (TYPE) {
-	case ParquetMetadataOperatorType::SCHEMA:
-		result->LoadSchemaData(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
-		break;
-	case ParquetMetadataOperatorType::META_DATA:
-		result->LoadRowGroupMetadata(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
-		break;
-	case ParquetMetadataOperatorType::KEY_VALUE_META_DATA:
-		result->LoadKeyValueMetaData(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
-		break;
-	case ParquetMetadataOperatorType::FILE_META_DATA:
-		result->LoadFileMetaData(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
-		break;
-	default:
-		throw InternalException("Unsupported ParquetMetadataOperatorType");
-	}
+	result->LoadData(context, bind_data, TYPE, bind_data.file_list->GetFirstFile());
 
 	return std::move(result);
 }
@@ -634,22 +748,7 @@ void ParquetMetaDataImplementation(ClientContext &context, TableFunctionInput &d
 				return;
 			}
 
-			switch (TYPE) {
-			case ParquetMetadataOperatorType::SCHEMA:
-				data.LoadSchemaData(context, bind_data.return_types, data.current_file);
-				break;
-			case ParquetMetadataOperatorType::META_DATA:
-				data.LoadRowGroupMetadata(context, bind_data.return_types, data.current_file);
-				break;
-			case ParquetMetadataOperatorType::KEY_VALUE_META_DATA:
-				data.LoadKeyValueMetaData(context, bind_data.return_types, data.current_file);
-				break;
-			case ParquetMetadataOperatorType::FILE_META_DATA:
-				data.LoadFileMetaData(context, bind_data.return_types, data.current_file);
-				break;
-			default:
-				throw InternalException("Unsupported ParquetMetadataOperatorType");
-			}
+			data.LoadData(context, bind_data, TYPE, data.current_file);
 			continue;
 		}
 		if (output.size() != 0) {
@@ -686,4 +785,11 @@ ParquetFileMetadataFunction::ParquetFileMetadataFunction()
                     ParquetMetaDataInit<ParquetMetadataOperatorType::FILE_META_DATA>) {
 }
 
+ParquetBloomProbeFunction::ParquetBloomProbeFunction()
+    : TableFunction("parquet_bloom_probe", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::ANY},
+                    ParquetMetaDataImplementation<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataBind<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataInit<ParquetMetadataOperatorType::BLOOM_PROBE>) {
+}
+
 } // namespace duckdb
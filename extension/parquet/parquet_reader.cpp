@@ -26,8 +26,10 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -40,11 +42,14 @@
 
 namespace duckdb {
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -702,6 +707,91 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(const ColumnReader &reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (reader.Type().id() == LogicalTypeId::VARCHAR && pq_col_stats.__isset.min_value &&
+	    pq_col_stats.__isset.max_value) {
+		// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+		// however, when reading remote Parquet files, skipping row groups is really important
+		// here, we implement a special case to check the full length for string filters
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+			auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+			for (auto &child_filter : and_filter.child_filters) {
+				auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+				if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+					break;
+				} else if (child_prune_result != and_result) {
+					and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+				}
+			}
+			return and_result;
+		}
+		return CheckParquetStringFilter(stats, pq_col_stats, filter);
+	}
+	return filter.CheckStatistics(stats);
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &reader,
+                                        const TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (parquet_options.encryption_config || reader.FileIdx() >= group.columns.size()) {
+		return false;
+	}
+	auto &column_meta = group.columns[reader.FileIdx()].meta_data;
+	if (!column_meta.__isset.bloom_filter_offset || !ParquetStatisticsUtils::BloomFilterSupported(reader.Type().id()) ||
+	    !ParquetStatisticsUtils::BloomFilterApplies(filter)) {
+		return false;
+	}
+	// the hashes are computed over the values as they are stored in the file - so we can only use the Bloom filter
+	// if the column is read as-is (e.g., not cast or converted from a DECIMAL or geometry)
+	auto &schema = reader.Schema();
+	if (schema.type != Type::BYTE_ARRAY && schema.type != Type::FIXED_LEN_BYTE_ARRAY) {
+		return false;
+	}
+	if (reader.Type() != DeriveLogicalType(schema, parquet_options.binary_as_string)) {
+		return false;
+	}
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(NumericCast<idx_t>(column_meta.bloom_filter_offset));
+	BloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		// unknown algorithm - we cannot use this Bloom filter
+		return false;
+	}
+	auto num_bytes = NumericCast<idx_t>(header.numBytes);
+	if (num_bytes < BloomFilter::MINIMUM_SIZE || num_bytes > BloomFilter::MAXIMUM_SIZE ||
+	    num_bytes % BloomFilter::BLOCK_SIZE != 0) {
+		throw InvalidInputException("Failed to read Parquet file \"%s\": invalid Bloom filter size %llu", file_name,
+		                            num_bytes);
+	}
+	auto buffer = allocator.Allocate(num_bytes);
+	trans.read(buffer.get(), NumericCast<uint32_t>(num_bytes));
+	BloomFilter bloom_filter(buffer.get(), num_bytes);
+	return ParquetStatisticsUtils::BloomFilterExcludes(filter, bloom_filter);
+}
+
+vector<bool> ParquetReader::BloomFilterExcludesRowGroups(ClientContext &context, idx_t col_idx,
+                                                         const TableFilter &filter) {
+	ParquetReaderScanState state;
+	vector<idx_t> groups;
+	for (idx_t group_idx = 0; group_idx < NumRowGroups(); group_idx++) {
+		groups.push_back(group_idx);
+	}
+	InitializeScan(context, state, std::move(groups));
+	auto &column_reader = *state.root_reader->Cast<StructColumnReader>().GetChildReader(col_idx);
+
+	vector<bool> result;
+	for (state.current_group = 0; state.current_group < NumericCast<int64_t>(state.group_idx_list.size());
+	     state.current_group++) {
+		result.push_back(BloomFilterExcludes(state, column_reader, filter));
+	}
+	return result;
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -713,40 +803,23 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
 
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
+			if (stats) {
+				// generated columns (e.g. file_row_number) have no column chunk
+				Statistics no_stats;
+				auto &pq_col_stats = column_reader->FileIdx() < group.columns.size()
+				                         ? group.columns[column_reader->FileIdx()].meta_data.statistics
+				                         : no_stats;
+				auto prune_result = CheckParquetFilter(*column_reader, *stats, pq_col_stats, filter);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
 				}
-			} else {
-				prune_result = filter.CheckStatistics(*stats);
 			}
-
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			if (!skip_chunk && BloomFilterExcludes(state, *column_reader, filter)) {
+				// the min/max values could not rule out the chunk, but the Bloom filter can
 				skip_chunk = true;
 			}
 			if (skip_chunk) {
@@ -761,6 +834,198 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+//! Whether or not a filter can be true for a NULL value
+static bool FilterCanMatchNull(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::BLOOM_FILTER:
+		return false;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (!FilterCanMatchNull(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (FilterCanMatchNull(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
+//! Intersects two sorted lists of disjoint row ranges
+static vector<ParquetRowRange> IntersectRowRanges(const vector<ParquetRowRange> &left,
+                                                  const vector<ParquetRowRange> &right) {
+	vector<ParquetRowRange> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue(left[left_idx].start, right[right_idx].start);
+		auto end = MinValue(left[left_idx].end, right[right_idx].end);
+		if (start < end) {
+			result.push_back({start, end});
+		}
+		if (left[left_idx].end < right[right_idx].end) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+//! Verifies that the pages in the offset index are in order and cover the row group
+static bool OffsetIndexIsValid(const OffsetIndex &offset_index, idx_t row_count) {
+	auto &page_locations = offset_index.page_locations;
+	if (page_locations.empty() || page_locations[0].first_row_index != 0 || page_locations[0].offset < 0) {
+		return false;
+	}
+	for (idx_t page_idx = 1; page_idx < page_locations.size(); page_idx++) {
+		auto &prev = page_locations[page_idx - 1];
+		auto &current = page_locations[page_idx];
+		if (current.first_row_index <= prev.first_row_index || current.offset <= prev.offset) {
+			return false;
+		}
+	}
+	return NumericCast<idx_t>(page_locations.back().first_row_index) < row_count;
+}
+
+void ParquetReader::PrepareRowRanges(ParquetReaderScanState &state) {
+	auto &group = GetGroup(state);
+	const auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (!reader_data.filters || parquet_options.encryption_config || state.group_offset >= group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+
+	// the page index can only be used for columns where every page starts at a new row
+	vector<optional_ptr<ColumnReader>> page_index_readers(reader_data.column_ids.size());
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (column_reader->FileIdx() >= group.columns.size() || column_reader->MaxRepeat() > 0 ||
+		    column_reader->Type().IsNested()) {
+			continue;
+		}
+		if (!group.columns[column_reader->FileIdx()].__isset.offset_index_offset) {
+			continue;
+		}
+		page_index_readers[col_idx] = column_reader;
+	}
+
+	// evaluate the filters on the min/max values of every page of the filtered columns
+	vector<unique_ptr<OffsetIndex>> offset_indexes(reader_data.column_ids.size());
+	vector<ParquetRowRange> row_ranges {{0, group_rows}};
+	bool pruned = false;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = page_index_readers[col_idx];
+		if (!column_reader) {
+			continue;
+		}
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.column_index_offset ||
+		    !column_reader->Stats(state.group_idx_list[state.current_group], group.columns)) {
+			continue;
+		}
+		auto &filter = *filter_entry->second;
+
+		auto offset_index = make_uniq<OffsetIndex>();
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		Read(*offset_index, *state.thrift_file_proto);
+		if (!OffsetIndexIsValid(*offset_index, group_rows)) {
+			page_index_readers[col_idx] = nullptr;
+			continue;
+		}
+		ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		Read(column_index, *state.thrift_file_proto);
+
+		auto &page_locations = offset_index->page_locations;
+		if (column_index.null_pages.size() != page_locations.size() ||
+		    column_index.min_values.size() != page_locations.size() ||
+		    column_index.max_values.size() != page_locations.size()) {
+			offset_indexes[col_idx] = std::move(offset_index);
+			continue;
+		}
+		vector<ParquetRowRange> column_ranges;
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			bool can_match;
+			if (column_index.null_pages[page_idx]) {
+				can_match = FilterCanMatchNull(filter);
+			} else {
+				Statistics page_stats;
+				page_stats.__set_min_value(column_index.min_values[page_idx]);
+				page_stats.__set_max_value(column_index.max_values[page_idx]);
+				if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+					page_stats.__set_null_count(column_index.null_counts[page_idx]);
+				}
+				auto stats = ParquetStatisticsUtils::TransformColumnStatistics(*column_reader, page_stats);
+				can_match = !stats || CheckParquetFilter(*column_reader, *stats, page_stats, filter) !=
+				                          FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+			if (!can_match) {
+				continue;
+			}
+			auto start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			auto end = page_idx + 1 < page_locations.size()
+			               ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			               : group_rows;
+			if (!column_ranges.empty() && column_ranges.back().end == start) {
+				column_ranges.back().end = end;
+			} else {
+				column_ranges.push_back({start, end});
+			}
+		}
+		row_ranges = IntersectRowRanges(row_ranges, column_ranges);
+		offset_indexes[col_idx] = std::move(offset_index);
+		pruned = true;
+	}
+	if (!pruned || (row_ranges.size() == 1 && row_ranges[0].start == 0 && row_ranges[0].end == group_rows)) {
+		// the page index does not allow us to skip anything
+		return;
+	}
+	if (row_ranges.empty()) {
+		// no page can contain any matching rows: skip the entire row group
+		state.group_offset = group_rows;
+		return;
+	}
+	state.row_ranges = std::move(row_ranges);
+
+	// use the offset index of all columns we read to jump over the pages that are skipped
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = page_index_readers[col_idx];
+		if (!column_reader) {
+			continue;
+		}
+		auto &offset_index = offset_indexes[col_idx];
+		if (!offset_index) {
+			auto &column_chunk = group.columns[column_reader->FileIdx()];
+			offset_index = make_uniq<OffsetIndex>();
+			trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+			Read(*offset_index, *state.thrift_file_proto);
+			if (!OffsetIndexIsValid(*offset_index, group_rows)) {
+				continue;
+			}
+		}
+		column_reader->SetPageLocations(std::move(offset_index->page_locations), state.row_ranges);
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -925,6 +1190,28 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const BloomTableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	// only the rows that are still in the mask have been decoded
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t approved_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	filter.Filter(v, vdata, sel, approved_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -974,6 +1261,16 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	case TableFilterType::IS_NULL:
 		FilterIsNull(v, filter_mask, count);
 		break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomTableFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto constant_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
@@ -1007,6 +1304,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
 		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
+		state.row_ranges.clear();
+		state.current_row_range = 0;
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
 			state.finished = true;
@@ -1022,6 +1321,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrepareRowRanges(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -1073,6 +1373,28 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	if (!state.row_ranges.empty()) {
+		// skip the rows that cannot pass the filters according to the page index
+		const auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+		auto &row_ranges = state.row_ranges;
+		while (state.current_row_range < row_ranges.size() &&
+		       row_ranges[state.current_row_range].end <= state.group_offset) {
+			state.current_row_range++;
+		}
+		auto skip_until =
+		    state.current_row_range < row_ranges.size() ? row_ranges[state.current_row_range].start : group_rows;
+		if (skip_until > state.group_offset) {
+			if (skip_until < group_rows) {
+				auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+				for (auto &file_col_idx : reader_data.column_ids) {
+					root_reader.GetChildReader(file_col_idx)->Skip(skip_until - state.group_offset);
+				}
+			}
+			state.group_offset = skip_until;
+			return true;
+		}
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
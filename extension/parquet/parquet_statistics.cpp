@@ -5,10 +5,15 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bloom_filter.hpp"
+#include "duckdb/common/bswap.hpp"
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
@@ -318,7 +323,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const ColumnReader &reader,
+                                                  const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
@@ -385,4 +396,101 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+bool ParquetStatisticsUtils::BloomFilterSupported(const LogicalTypeId &type_id) {
+	switch (type_id) {
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+hash_t ParquetStatisticsUtils::BloomFilterHash(const_data_ptr_t data, idx_t size) {
+	// the Parquet specification prescribes xxHash64 with a seed of 0
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+static bool IsEqualityFilter(const TableFilter &filter) {
+	if (filter.filter_type != TableFilterType::CONSTANT_COMPARISON) {
+		return false;
+	}
+	auto &constant_filter = filter.Cast<ConstantFilter>();
+	return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+	       ParquetStatisticsUtils::BloomFilterSupported(constant_filter.constant.type().id()) &&
+	       !constant_filter.constant.IsNull();
+}
+
+bool ParquetStatisticsUtils::BloomFilterApplies(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return IsEqualityFilter(filter);
+	case TableFilterType::CONJUNCTION_AND: {
+		// "x = 'a' AND x IS NOT NULL" - one of the children has to be an equality
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterApplies(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// IN-lists: "x = 'a' OR x = 'b'" - all children have to be equalities
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterApplies(*child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+static hash_t BloomFilterHashConstant(const Value &constant) {
+	if (constant.type().id() == LogicalTypeId::UUID) {
+		// UUIDs are written as 16 big-endian bytes, with the sign bit of the upper half flipped (see UUIDColumnWriter)
+		auto uuid = constant.GetValueUnsafe<hugeint_t>();
+		data_t bytes[sizeof(hugeint_t)];
+		Store<uint64_t>(BSwap(static_cast<uint64_t>(uuid.upper) ^ (uint64_t(1) << 63)), bytes);
+		Store<uint64_t>(BSwap(uuid.lower), bytes + sizeof(uint64_t));
+		return ParquetStatisticsUtils::BloomFilterHash(bytes, sizeof(bytes));
+	}
+	// VARCHAR and BLOB values are hashed without their length
+	auto &str = StringValue::Get(constant);
+	return ParquetStatisticsUtils::BloomFilterHash(const_data_ptr_cast(str.c_str()), str.size());
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const TableFilter &filter, const BloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return IsEqualityFilter(filter) &&
+		       !bloom_filter.Lookup(BloomFilterHashConstant(filter.Cast<ConstantFilter>().constant));
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(*child_filter, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludes(*child_filter, bloom_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
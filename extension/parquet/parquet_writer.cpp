@@ -25,12 +25,15 @@ using namespace duckdb_apache::thrift;            // NOLINT
 using namespace duckdb_apache::thrift::protocol;  // NOLINT
 using namespace duckdb_apache::thrift::transport; // NOLINT
 
+using duckdb_parquet::format::BloomFilterHeader;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
@@ -319,11 +322,13 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, ParquetVersion parquet_version_p, optional_idx encoding_p,
+                             double bloom_filter_false_positive_ratio_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), parquet_version(parquet_version_p), encoding(encoding_p),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -347,7 +352,7 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 	protocol = tproto_factory.getProtocol(std::make_shared<MyTransport>(*writer));
 
 	file_meta_data.num_rows = 0;
-	file_meta_data.version = 1;
+	file_meta_data.version = static_cast<int32_t>(parquet_version);
 
 	file_meta_data.__isset.created_by = true;
 	file_meta_data.created_by = "DuckDB";
@@ -506,11 +511,14 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		throw InternalException("Attempting to flush a row group with no rows");
 	}
 	row_group.file_offset = writer->GetTotalWritten();
+	page_indexes.emplace_back(row_group.columns.size());
+	bloom_filters.resize(row_group.columns.size());
 	for (idx_t col_idx = 0; col_idx < states.size(); col_idx++) {
 		const auto &col_writer = column_writers[col_idx];
 		auto write_state = std::move(states[col_idx]);
 		col_writer->FinalizeWrite(*write_state);
 	}
+	WriteBloomFilters(row_group);
 	// let's make sure all offsets are ay-okay
 	ValidateColumnOffsets(file_name, writer->GetTotalWritten(), row_group);
 
@@ -533,7 +541,84 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::SetPageIndex(idx_t column_idx, unique_ptr<ColumnIndex> column_index,
+                                 OffsetIndex offset_index) {
+	D_ASSERT(!page_indexes.empty());
+	auto &row_group_page_indexes = page_indexes.back();
+	D_ASSERT(column_idx < row_group_page_indexes.size());
+	auto page_index = make_uniq<ParquetPageIndex>();
+	page_index->column_index = std::move(column_index);
+	page_index->offset_index = std::move(offset_index);
+	row_group_page_indexes[column_idx] = std::move(page_index);
+}
+
+void ParquetWriter::SetBloomFilter(idx_t column_idx, unique_ptr<BloomFilter> bloom_filter) {
+	D_ASSERT(column_idx < bloom_filters.size());
+	bloom_filters[column_idx] = std::move(bloom_filter);
+}
+
+void ParquetWriter::WriteBloomFilters(ParquetRowGroup &row_group) {
+	for (idx_t col_idx = 0; col_idx < bloom_filters.size(); col_idx++) {
+		auto &bloom_filter = bloom_filters[col_idx];
+		if (!bloom_filter) {
+			continue;
+		}
+		BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter->SizeInBytes());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+		auto &column_chunk = row_group.columns[col_idx];
+		const auto offset = writer->GetTotalWritten();
+		Write(header);
+		WriteData(bloom_filter->Data(), NumericCast<uint32_t>(bloom_filter->SizeInBytes()));
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	bloom_filters.clear();
+}
+
+void ParquetWriter::WritePageIndexes() {
+	D_ASSERT(page_indexes.size() == file_meta_data.row_groups.size());
+	// following the specification, we first write all column indexes, followed by all offset indexes
+	for (idx_t row_group_idx = 0; row_group_idx < page_indexes.size(); row_group_idx++) {
+		auto &row_group = file_meta_data.row_groups[row_group_idx];
+		for (idx_t col_idx = 0; col_idx < page_indexes[row_group_idx].size(); col_idx++) {
+			auto &page_index = page_indexes[row_group_idx][col_idx];
+			if (!page_index || !page_index->column_index) {
+				continue;
+			}
+			auto &column_chunk = row_group.columns[col_idx];
+			const auto offset = writer->GetTotalWritten();
+			Write(*page_index->column_index);
+			column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+			column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+		}
+	}
+	for (idx_t row_group_idx = 0; row_group_idx < page_indexes.size(); row_group_idx++) {
+		auto &row_group = file_meta_data.row_groups[row_group_idx];
+		for (idx_t col_idx = 0; col_idx < page_indexes[row_group_idx].size(); col_idx++) {
+			auto &page_index = page_indexes[row_group_idx][col_idx];
+			if (!page_index) {
+				continue;
+			}
+			auto &column_chunk = row_group.columns[col_idx];
+			const auto offset = writer->GetTotalWritten();
+			Write(page_index->offset_index);
+			column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+			column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+		}
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	// the page indexes are not encrypted, so we do not write them for encrypted files
+	if (!encryption_config) {
+		WritePageIndexes();
+	}
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
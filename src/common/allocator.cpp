@@ -254,6 +254,12 @@ void Allocator::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+void Allocator::SetThreadNode(idx_t node) {
+#ifdef USE_JEMALLOC
+	JemallocExtension::SetThreadNode(node);
+#endif
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Info (extended)
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,115 @@
+#include "duckdb/common/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+
+#include <cmath>
+
+namespace duckdb {
+
+//! The salts used to derive the 8 bit positions within a block (as defined by the Parquet specification)
+static constexpr const uint32_t BLOOM_FILTER_SALT[BloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+BloomFilter::BloomFilter(idx_t size_in_bytes) {
+	Initialize(size_in_bytes);
+}
+
+BloomFilter::BloomFilter(const_data_ptr_t data, idx_t size_in_bytes) {
+	if (size_in_bytes < MINIMUM_SIZE || size_in_bytes > MAXIMUM_SIZE || size_in_bytes % BLOCK_SIZE != 0) {
+		throw InvalidInputException("Invalid Bloom filter size %llu", size_in_bytes);
+	}
+	Initialize(size_in_bytes);
+	memcpy(blocks.get(), data, size_in_bytes);
+}
+
+void BloomFilter::Initialize(idx_t size_in_bytes) {
+	size_in_bytes = MinValue<idx_t>(MaxValue<idx_t>(size_in_bytes, MINIMUM_SIZE), MAXIMUM_SIZE);
+	num_blocks = (size_in_bytes + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	blocks = make_unsafe_uniq_array<uint32_t>(num_blocks * WORDS_PER_BLOCK);
+}
+
+idx_t BloomFilter::OptimalSize(idx_t distinct_values, double false_positive_rate) {
+	D_ASSERT(false_positive_rate > 0 && false_positive_rate < 1);
+	// for a split-block Bloom filter with 8 bits per key, the false positive rate is roughly
+	// (1 - e^(-8 * n / m))^8, solving for m gives us the number of bits we need
+	const auto num_bits =
+	    -8.0 * static_cast<double>(distinct_values) / std::log(1.0 - std::pow(false_positive_rate, 1.0 / 8.0));
+	if (num_bits >= static_cast<double>(MAXIMUM_SIZE * 8)) {
+		return MAXIMUM_SIZE;
+	}
+	const auto num_bytes = static_cast<idx_t>(num_bits / 8.0);
+	return MinValue<idx_t>(MaxValue<idx_t>(NextPowerOfTwo(num_bytes), MINIMUM_SIZE), MAXIMUM_SIZE);
+}
+
+void BloomFilter::Insert(hash_t hash) {
+	auto block = blocks.get() + BlockOffset(hash);
+	const auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool BloomFilter::Lookup(hash_t hash) const {
+	auto block = blocks.get() + BlockOffset(hash);
+	const auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		const auto mask = uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+		if ((block[i] & mask) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void BloomFilter::Insert(Vector &hashes, idx_t count) {
+	D_ASSERT(hashes.GetType().id() == LogicalTypeId::UBIGINT);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		Insert(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+idx_t BloomFilter::Lookup(Vector &hashes, SelectionVector &sel, idx_t count) const {
+	D_ASSERT(hashes.GetType().id() == LogicalTypeId::UBIGINT);
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		auto hash = *ConstantVector::GetData<hash_t>(hashes);
+		return Lookup(hash) ? count : 0;
+	}
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		sel.set_index(result_count, idx);
+		result_count += Lookup(hash_data[idx]);
+	}
+	return result_count;
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	if (num_blocks != other.num_blocks) {
+		throw InternalException("BloomFilter::Merge - filters have different sizes");
+	}
+	auto target = blocks.get();
+	auto source = other.blocks.get();
+	for (idx_t i = 0; i < num_blocks * WORDS_PER_BLOCK; i++) {
+		target[i] |= source[i];
+	}
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "size", SizeInBytes());
+	serializer.WriteProperty(101, "data", Data(), SizeInBytes());
+}
+
+unique_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto size = deserializer.ReadProperty<idx_t>(100, "size");
+	auto result = make_uniq<BloomFilter>(size);
+	deserializer.ReadProperty(101, "data", data_ptr_cast(result->blocks.get()), result->SizeInBytes());
+	return result;
+}
+
+} // namespace duckdb
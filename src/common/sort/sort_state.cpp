@@ -453,6 +453,20 @@ void GlobalSortState::InitializeMergeRound() {
 	}
 }
 
+void GlobalSortState::InitializeMergeRound(idx_t num_threads) {
+	InitializeMergeRound();
+	// Merge Path partitions have block_capacity rows, which leaves threads idle if only few pairs remain
+	idx_t merge_count = 0;
+	for (auto &sb : sorted_blocks) {
+		merge_count += sb->Count();
+	}
+	const auto num_partitions = num_threads * SortConstants::MERGE_PARTITIONS_PER_THREAD;
+	auto partition_size = (merge_count + num_partitions - 1) / num_partitions;
+	partition_size = AlignValue<idx_t, STANDARD_VECTOR_SIZE>(partition_size);
+	partition_size = MaxValue<idx_t>(partition_size, SortConstants::MIN_MERGE_PARTITION_SIZE);
+	block_capacity = MinValue(block_capacity, partition_size);
+}
+
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
 	for (auto &sorted_block_vector : sorted_blocks_temp) {
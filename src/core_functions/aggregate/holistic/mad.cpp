@@ -264,6 +264,7 @@ AggregateFunction GetTypedMedianAbsoluteDeviationAggregateFunction(const Logical
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.window_build = OP::template WindowBuild<STATE, INPUT_TYPE>;
 	return fun;
 }
 
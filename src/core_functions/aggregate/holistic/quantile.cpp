@@ -409,6 +409,7 @@ struct ScalarDiscreteQuantile {
 		auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, type);
 		fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
 		fun.window_init = OP::WindowInit<STATE, INPUT_TYPE>;
+		fun.window_build = OP::WindowBuild<STATE, INPUT_TYPE>;
 		return fun;
 	}
 
@@ -444,6 +445,7 @@ struct ListDiscreteQuantile {
 		fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 		fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+		fun.window_build = OP::template WindowBuild<STATE, INPUT_TYPE>;
 		return fun;
 	}
 
@@ -527,6 +529,7 @@ struct ScalarContinuousQuantile {
 		fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 		fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+		fun.window_build = OP::template WindowBuild<STATE, INPUT_TYPE>;
 		return fun;
 	}
 };
@@ -540,6 +543,7 @@ struct ListContinuousQuantile {
 		fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 		fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+		fun.window_build = OP::template WindowBuild<STATE, INPUT_TYPE>;
 		return fun;
 	}
 };
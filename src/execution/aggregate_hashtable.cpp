@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -41,7 +42,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), sink_count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -117,6 +119,10 @@ idx_t GroupedAggregateHashTable::Count() const {
 	return count;
 }
 
+idx_t GroupedAggregateHashTable::SinkCount() const {
+	return sink_count;
+}
+
 idx_t GroupedAggregateHashTable::InitialCapacity() {
 	return STANDARD_VECTOR_SIZE * 2ULL;
 }
@@ -160,6 +166,15 @@ void GroupedAggregateHashTable::ClearPointerTable() {
 
 void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
+	sink_count = 0;
+}
+
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	skip_lookups = skip_lookups_p;
 }
 
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
@@ -247,6 +262,7 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 #endif
 
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	sink_count += groups.size();
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -313,6 +329,32 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
+	group_hashes_v.Flatten(groups.size());
+	auto hashes = FlatVector::GetData<hash_t>(group_hashes_v);
+
+	addresses_v.Flatten(groups.size());
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+
+	// Make a chunk that references the groups and the hashes and convert to unified format
+	if (state.group_chunk.ColumnCount() == 0) {
+		state.group_chunk.InitializeEmpty(layout.GetTypes());
+	}
+	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
+	state.group_chunk.SetCardinality(groups);
+
+	// convert all vectors to unified format
+	auto &chunk_state = state.append_state.chunk_state;
+	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
+
+	if (skip_lookups) {
+		// the pointer table is not used: every row creates a new group
+		return CreateGroupsInternal(groups, addresses_v, new_groups_out);
+	}
+
 	// Need to fit the entire vector, and resize at threshold
 	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
 		Verify();
@@ -320,12 +362,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	D_ASSERT(capacity - Count() >= groups.size()); // we need to be able to fit at least one vector of data
 
-	group_hashes_v.Flatten(groups.size());
-	auto hashes = FlatVector::GetData<hash_t>(group_hashes_v);
-
-	addresses_v.Flatten(groups.size());
-	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
-
 	// Compute the entry in the table based on the hash using a modulo,
 	// and precompute the hash salts for faster comparison below
 	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
@@ -336,24 +372,18 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		D_ASSERT(ht_offsets[r] == hash % capacity);
 		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
 	}
+	// if the hash table does not fit into the CPU cache, the probing below is dominated by cache misses
+	// we then prefetch the entries and rows of the entire vector before touching them, so the misses overlap
+	const bool prefetch = capacity > PREFETCH_THRESHOLD;
+	if (prefetch) {
+		for (idx_t r = 0; r < groups.size(); r++) {
+			DUCKDB_PREFETCH(entries + ht_offsets[r]);
+		}
+	}
 
 	// we start out with all entries [0, 1, 2, ..., groups.size()]
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
-	// Make a chunk that references the groups and the hashes and convert to unified format
-	if (state.group_chunk.ColumnCount() == 0) {
-		state.group_chunk.InitializeEmpty(layout.GetTypes());
-	}
-	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
-	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
-		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
-	}
-	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
-	state.group_chunk.SetCardinality(groups);
-
-	// convert all vectors to unified format
-	auto &chunk_state = state.append_state.chunk_state;
-	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
 	if (!state.group_data) {
 		state.group_data = make_unsafe_uniq_array_uninitialized<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
 	}
@@ -426,6 +456,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 				const auto &entry = entries[ht_offsets[index]];
 				addresses[index] = entry.GetPointer();
 			}
+			if (prefetch) {
+				for (idx_t need_compare_idx = 0; need_compare_idx < need_compare_count; need_compare_idx++) {
+					DUCKDB_PREFETCH(addresses[state.group_compare_vector.get_index(need_compare_idx)]);
+				}
+			}
 
 			// Perform group comparisons
 			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
@@ -449,6 +484,28 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	return new_group_count;
 }
 
+idx_t GroupedAggregateHashTable::CreateGroupsInternal(DataChunk &groups, Vector &addresses_v,
+                                                      SelectionVector &new_groups_out) {
+	const auto new_group_count = groups.size();
+	auto &chunk_state = state.append_state.chunk_state;
+	partitioned_data->AppendUnified(state.append_state, state.group_chunk, *FlatVector::IncrementalSelectionVector(),
+	                                new_group_count);
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+	                                new_group_count);
+
+	// The rows are not inserted into the pointer table, duplicate groups are combined when the data is combined
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	for (idx_t i = 0; i < new_group_count; i++) {
+		addresses[i] = row_locations[row_sel.get_index(i)];
+		new_groups_out.set_index(i, i);
+	}
+
+	count += new_group_count;
+	return new_group_count;
+}
+
 // this is to support distinct aggregations where we need to record whether we
 // have already seen a value for a group
 idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &group_hashes, Vector &addresses_out,
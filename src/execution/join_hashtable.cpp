@@ -1,6 +1,7 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -169,6 +170,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	auto ht_offsets_dense = FlatVector::GetData<idx_t>(state.ht_offsets_dense_v);
 
 	idx_t non_empty_count = 0;
+	// if the hash table does not fit into the cache, the probe is dominated by cache misses
+	// we then prefetch the entries a fixed distance ahead of the loop that accesses them, so the misses overlap
+	const bool prefetch = HashTablePrefetch::Enabled(ht->capacity * sizeof(ht_entry_t) +
+	                                                 ht->Count() * ht->layout.GetRowWidth());
 
 	// first, filter out the empty rows and calculate the offset
 	for (idx_t i = 0; i < count; i++) {
@@ -177,11 +182,17 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
+		if (prefetch && i < HashTablePrefetch::DISTANCE) {
+			DUCKDB_PREFETCH(entries + ht_offset);
+		}
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
 	// first location where we access the big entries array
 	for (idx_t i = 0; i < count; i++) {
+		if (prefetch && i + HashTablePrefetch::DISTANCE < count) {
+			DUCKDB_PREFETCH(entries + ht_offsets_dense[i + HashTablePrefetch::DISTANCE]);
+		}
 		idx_t ht_offset = ht_offsets_dense[i];
 		auto &entry = entries[ht_offset];
 		bool occupied = entry.IsOccupied();
@@ -255,6 +266,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			if (prefetch && occupied) {
+				// the row is compared after this loop - start loading it already
+				DUCKDB_PREFETCH(row_ptr_insert_to[row_index]);
+			}
 		}
 
 		if (salt_match_count != 0) {
@@ -856,6 +871,8 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			// the next row in the chain is compared in the next iteration - start loading it already
+			DUCKDB_PREFETCH(ptrs[idx]);
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -14,6 +14,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -111,8 +112,9 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+	    : op(op_p), context(context_p),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
@@ -136,6 +138,7 @@ public:
 	void InitializeProbeSpill();
 
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -394,6 +397,10 @@ public:
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
+		if (sink.op.filter_pushdown) {
+			sink.op.filter_pushdown->BuildBloomFilters(*sink.global_filter_state, *sink.hash_table, chunk_idx_from,
+			                                           chunk_idx_to, parallel);
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
@@ -447,6 +454,9 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.op.filter_pushdown) {
+			sink.op.filter_pushdown->PushBloomFilters(*sink.global_filter_state, sink.op);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -561,7 +571,61 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+void JoinFilterPushdownInfo::BuildBloomFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, idx_t chunk_idx_from,
+                                               idx_t chunk_idx_to, bool parallel) const {
+	if (gstate.bloom_filters.empty() || chunk_idx_from == chunk_idx_to) {
+		return;
+	}
+	// when running in parallel, every task builds its own filters that are merged into the global filters afterwards
+	vector<shared_ptr<BloomFilter>> local_filters;
+	for (auto &bloom_filter : gstate.bloom_filters) {
+		local_filters.push_back(parallel ? make_shared_ptr<BloomFilter>(bloom_filter->SizeInBytes()) : bloom_filter);
+	}
+
+	// gather the join keys from the hash table and insert their hashes
+	auto &data_collection = ht.GetDataCollection();
+	const auto &layout_types = ht.layout.GetTypes();
+	vector<Vector> keys;
+	for (auto &filter_idx : gstate.bloom_filter_idxs) {
+		keys.emplace_back(layout_types[filters[filter_idx].join_condition]);
+	}
+	Vector hashes(LogicalType::HASH);
+	TupleDataChunkIterator iterator(data_collection, TupleDataPinProperties::KEEP_EVERYTHING_PINNED, chunk_idx_from,
+	                                chunk_idx_to, false);
+	auto &row_locations = iterator.GetChunkState().row_locations;
+	do {
+		const auto count = iterator.GetCurrentChunkCount();
+		for (idx_t i = 0; i < gstate.bloom_filter_idxs.size(); i++) {
+			const auto column_id = filters[gstate.bloom_filter_idxs[i]].join_condition;
+			// the gather only marks NULL keys - reset the NULLs of the previous chunk
+			FlatVector::Validity(keys[i]).Reset();
+			data_collection.Gather(row_locations, *FlatVector::IncrementalSelectionVector(), count, column_id, keys[i],
+			                       *FlatVector::IncrementalSelectionVector(), nullptr);
+			VectorOperations::Hash(keys[i], hashes, count);
+			local_filters[i]->Insert(hashes, count);
+		}
+	} while (iterator.Next());
+
+	if (parallel) {
+		lock_guard<mutex> guard(gstate.lock);
+		for (idx_t i = 0; i < local_filters.size(); i++) {
+			gstate.bloom_filters[i]->Merge(*local_filters[i]);
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushBloomFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+	for (idx_t i = 0; i < gstate.bloom_filters.size(); i++) {
+		auto filter_col_idx = filters[gstate.bloom_filter_idxs[i]].probe_column_index.column_index;
+		auto bloom_filter = make_uniq<BloomTableFilter>(std::move(gstate.bloom_filters[i]));
+		dynamic_filters->PushFilter(op, filter_col_idx, std::move(bloom_filter));
+	}
+	gstate.bloom_filter_idxs.clear();
+	gstate.bloom_filters.clear();
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -573,6 +637,8 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
 	// create a filter for each of the aggregates
+	gstate.bloom_filter_idxs.clear();
+	gstate.bloom_filters.clear();
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
 		auto filter_col_idx = filter.probe_column_index.column_index;
@@ -598,10 +664,26 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			// the range can be wide but sparse - also try to push a Bloom filter over the keys
+			if (bloom_filter_pushdown) {
+				gstate.bloom_filter_idxs.push_back(filter_idx);
+			}
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
 	}
+
+	if (ht.Count() > BLOOM_FILTER_MAX_BUILD_SIZE) {
+		// the build side is too large for a Bloom filter to be selective
+		gstate.bloom_filter_idxs.clear();
+		return;
+	}
+	// every key column gets its own Bloom filter, sized for the number of rows in the hash table
+	// the filters are built while the hash table is finalized (BuildBloomFilters), and pushed afterwards
+	const auto filter_size = BloomFilter::OptimalSize(ht.Count(), BLOOM_FILTER_FALSE_POSITIVE_RATE);
+	for (idx_t i = 0; i < gstate.bloom_filter_idxs.size(); i++) {
+		gstate.bloom_filters.push_back(make_shared_ptr<BloomFilter>(filter_size));
+	}
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -647,7 +729,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, ht, *this);
 	}
 
 	// check for possible perfect hash table
@@ -661,6 +743,11 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
 		sink.ScheduleFinalize(pipeline, event);
+	} else if (filter_pushdown && ht.Count() > 0) {
+		// there is no finalize event that builds the Bloom filters - build them here
+		auto &filter_state = *sink.global_filter_state;
+		filter_pushdown->BuildBloomFilters(filter_state, ht, 0, ht.GetDataCollection().ChunkCount(), false);
+		filter_pushdown->PushBloomFilters(filter_state, *this);
 	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
@@ -185,8 +185,9 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 }
 
 void PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGlobalSinkState &state) {
-	// Initialize global sort state for a round of merging
-	state.global_sort_state.InitializeMergeRound();
+	// Initialize global sort state for a round of merging, split into enough partitions to keep all threads busy
+	auto &ts = TaskScheduler::GetScheduler(pipeline.GetClientContext());
+	state.global_sort_state.InitializeMergeRound(NumericCast<idx_t>(ts.NumberOfThreads()));
 	auto new_event = make_shared_ptr<OrderMergeEvent>(state, pipeline);
 	event.InsertEvent(std::move(new_event));
 }
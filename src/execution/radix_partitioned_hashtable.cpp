@@ -142,6 +142,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If a full HT has more groups than this fraction of the rows added to it, it barely reduces the data,
+	//! and we skip lookups, deferring the aggregation to when the partitions are combined
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
+	//! After skipping lookups for this many full HTs, we look up groups for one HT again to re-check the reduction
+	static constexpr const idx_t SKIP_LOOKUPS_RECHECK_INTERVAL = 8;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -333,6 +338,9 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Whether the HT has skipped lookups, and how many times it filled up since it last started skipping lookups
+	bool skipped_lookups = false;
+	idx_t skipped_fills = 0;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
@@ -462,12 +470,32 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		return; // We can fit another chunk
 	}
 
-	if (gstate.number_of_threads > 2) {
-		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
-		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+	if (ht.SkipLookups()) {
+		// The pointer table is not used while skipping lookups, so there is nothing to clear
 		ht.ResetCount();
-		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+		if (++lstate.skipped_fills >= gstate.config.SKIP_LOOKUPS_RECHECK_INTERVAL) {
+			// Periodically go back to looking up groups for one HT, so we re-check whether the HT reduces the data
+			ht.SetSkipLookups(false);
+			lstate.skipped_fills = 0;
+		}
+	} else {
+		const auto reduction_threshold = gstate.config.SKIP_LOOKUPS_THRESHOLD * static_cast<double>(ht.SinkCount());
+		if (gstate.number_of_threads > 1 && static_cast<double>(ht.Count()) > reduction_threshold) {
+			// (Nearly) every row created a new group, probing the HT only costs time: from now on, we append the rows
+			// without looking up their groups, and aggregate them when combining the partitions in the Finalize
+			// With a single thread, the HT does not need to be combined at all unless we go external, so we don't
+			// do this
+			ht.SetSkipLookups(true);
+			lstate.skipped_lookups = true;
+		}
+		if (gstate.number_of_threads > 2 || lstate.skipped_lookups) {
+			// 'Reset' the HT without taking its data, we can just keep appending to the same collection
+			// This only works because we never resize the HT
+			ht.ClearPointerTable();
+			ht.ResetCount();
+			// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+			// Once lookups were skipped, the data has rows that are not in the pointer table, and we can't resize
+		}
 	}
 
 	// Check if we need to repartition
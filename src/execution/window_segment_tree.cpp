@@ -508,31 +508,37 @@ unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetGlobalState(idx_t g
 
 void WindowCustomAggregator::Finalize(WindowAggregatorState &gsink, WindowAggregatorState &lstate,
                                       const FrameStats &stats) {
-	//	Single threaded Finalize for now
 	auto &gcsink = gsink.Cast<WindowCustomAggregatorGlobalState>();
-	lock_guard<mutex> gestate_guard(gcsink.lock);
-	if (gcsink.finalized) {
-		return;
-	}
+	auto &gcstate = *gcsink.gcstate;
 
-	WindowAggregator::Finalize(gsink, lstate, stats);
+	//	Single threaded initialization for now
+	{
+		lock_guard<mutex> gestate_guard(gcsink.lock);
+		if (!gcsink.finalized) {
+			WindowAggregator::Finalize(gsink, lstate, stats);
 
-	auto &inputs = gcsink.inputs;
-	auto &filter_mask = gcsink.filter_mask;
-	auto &filter_packed = gcsink.filter_packed;
-	filter_mask.Pack(filter_packed, filter_mask.target_count);
+			auto &inputs = gcsink.inputs;
+			auto &filter_mask = gcsink.filter_mask;
+			auto &filter_packed = gcsink.filter_packed;
+			filter_mask.Pack(filter_packed, filter_mask.target_count);
 
-	gcsink.partition_input =
-	    make_uniq<WindowPartitionInput>(inputs.data.data(), inputs.ColumnCount(), inputs.size(), filter_packed, stats);
+			gcsink.partition_input = make_uniq<WindowPartitionInput>(inputs.data.data(), inputs.ColumnCount(),
+			                                                         inputs.size(), filter_packed, stats);
 
-	if (aggr.function.window_init) {
-		auto &gcstate = *gcsink.gcstate;
+			if (aggr.function.window_init) {
+				AggregateInputData aggr_input_data(aggr.GetFunctionData(), gcstate.allocator);
+				aggr.function.window_init(aggr_input_data, *gcsink.partition_input, gcstate.state.data());
+			}
 
-		AggregateInputData aggr_input_data(aggr.GetFunctionData(), gcstate.allocator);
-		aggr.function.window_init(aggr_input_data, *gcsink.partition_input, gcstate.state.data());
+			++gcsink.finalized;
+		}
 	}
 
-	++gcsink.finalized;
+	//	All threads help to build the shared state
+	if (aggr.function.window_build) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), lstate.allocator);
+		aggr.function.window_build(aggr_input_data, gcstate.state.data());
+	}
 }
 
 unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
@@ -1390,6 +1396,10 @@ class WindowDistinctAggregatorGlobalState : public WindowAggregatorGlobalState {
 public:
 	using GlobalSortStatePtr = unique_ptr<GlobalSortState>;
 	class DistinctSortTree;
+	// prev_idx, input_idx
+	using ZippedTuple = std::tuple<idx_t, idx_t>;
+	using ZippedElements = vector<ZippedTuple>;
+	using ZippedTree = MergeSortTree<ZippedTuple>;
 
 	WindowDistinctAggregatorGlobalState(const WindowDistinctAggregator &aggregator, idx_t group_count);
 	~WindowDistinctAggregatorGlobalState() override;
@@ -1407,6 +1417,8 @@ public:
 	DataChunk sort_chunk;
 	DataChunk payload_chunk;
 
+	//! The merge sort tree of the previous indices, which all threads help to build
+	unique_ptr<ZippedTree> zipped_tree;
 	//! The merge sort tree for the aggregate.
 	unique_ptr<DistinctSortTree> merge_sort_tree;
 
@@ -1526,30 +1538,40 @@ void WindowDistinctAggregatorGlobalState::Sink(DataChunk &arg_chunk, idx_t input
 	}
 }
 
+class WindowDistinctAggregatorGlobalState::DistinctSortTree : public MergeSortTree<idx_t, idx_t> {
+public:
+	using ZippedTree = WindowDistinctAggregatorGlobalState::ZippedTree;
+
+	DistinctSortTree(ZippedTree &zipped_tree, WindowDistinctAggregatorGlobalState &gdsink);
+};
+
 void WindowDistinctAggregator::Finalize(WindowAggregatorState &gsink, WindowAggregatorState &lstate,
                                         const FrameStats &stats) {
 	auto &gdsink = gsink.Cast<WindowDistinctAggregatorGlobalState>();
 
-	//	Single threaded Finalize for now
+	//	Single threaded sorting for now
+	{
+		lock_guard<mutex> gestate_guard(gdsink.lock);
+		if (!gdsink.zipped_tree) {
+			gdsink.Finalize(stats);
+		}
+	}
+
+	//	All threads build the runs of the merge sort tree
+	gdsink.zipped_tree->Build();
+
+	//	Single threaded aggregation of the tree for now
 	lock_guard<mutex> gestate_guard(gdsink.lock);
 	if (gdsink.finalized) {
 		return;
 	}
 
-	gdsink.Finalize(stats);
+	using DistinctSortTree = WindowDistinctAggregatorGlobalState::DistinctSortTree;
+	gdsink.merge_sort_tree = make_uniq<DistinctSortTree>(*gdsink.zipped_tree, gdsink);
 
 	++gdsink.finalized;
 }
 
-class WindowDistinctAggregatorGlobalState::DistinctSortTree : public MergeSortTree<idx_t, idx_t> {
-public:
-	// prev_idx, input_idx
-	using ZippedTuple = std::tuple<idx_t, idx_t>;
-	using ZippedElements = vector<ZippedTuple>;
-
-	DistinctSortTree(ZippedElements &&prev_idcs, WindowDistinctAggregatorGlobalState &gdsink);
-};
-
 void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
 	//	5: Sort sorted lexicographically increasing
 	global_sort->AddLocalState(local_sort);
@@ -1572,8 +1594,7 @@ void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
 	//	6:	prevIdcs ← []
 	//	7:	prevIdcs[0] ← “-”
 	const auto count = inputs.size();
-	using ZippedTuple = DistinctSortTree::ZippedTuple;
-	DistinctSortTree::ZippedElements prev_idcs;
+	ZippedElements prev_idcs;
 	prev_idcs.resize(count);
 
 	//	To handle FILTER clauses we make the missing elements
@@ -1625,10 +1646,12 @@ void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
 	}
 	//	13:	return prevIdcs
 
-	merge_sort_tree = make_uniq<DistinctSortTree>(std::move(prev_idcs), *this);
+	//	The levels of the tree are built by all threads
+	zipped_tree = make_uniq<ZippedTree>();
+	zipped_tree->Allocate(std::move(prev_idcs));
 }
 
-WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedElements &&prev_idcs,
+WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedTree &zipped_tree,
                                                                         WindowDistinctAggregatorGlobalState &gdsink) {
 	auto &aggr = gdsink.aggregator.aggr;
 	auto &allocator = gdsink.allocator;
@@ -1659,7 +1682,6 @@ WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedEl
 
 	// compute space required to store aggregation states of merge sort tree
 	// this is one aggregate state per entry per level
-	MergeSortTree<ZippedTuple> zipped_tree(std::move(prev_idcs));
 	internal_nodes = 0;
 	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
 		internal_nodes += zipped_tree.tree[level_nr].first.size();
@@ -1719,6 +1741,8 @@ WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedEl
 		}
 
 		tree.emplace_back(std::move(level), std::move(zipped_tree.tree[level_nr].second));
+		//	The zipped level is no longer needed
+		ZippedTree::Elements().swap(zipped_level);
 
 		levels_flat_start.push_back(levels_flat_offset);
 		level_width *= FANOUT;
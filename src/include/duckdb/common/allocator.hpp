@@ -121,6 +121,8 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	//! Lets the calling thread allocate from an arena that is shared by the threads of the given NUMA node
+	static void SetThreadNode(idx_t node);
 
 private:
 	allocate_function_ptr_t allocate_function;
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! A split-block Bloom filter (SBBF), using the block layout of the Parquet specification.
+//! Every key maps to exactly one 256-bit block, in which it sets 8 bits (one per 32-bit word). This means that an
+//! insert or a lookup touches a single cache line, and that the filter can be used for Parquet's bloom filters
+//! (provided the hashes are computed with xxHash64 over the plain-encoded values)
+class BloomFilter {
+public:
+	//! The number of 32-bit words in a block
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = WORDS_PER_BLOCK * sizeof(uint32_t);
+	//! The minimum size of a Bloom filter in bytes
+	static constexpr const idx_t MINIMUM_SIZE = BLOCK_SIZE;
+	//! The maximum size of a Bloom filter in bytes (128MB, the maximum allowed by Parquet)
+	static constexpr const idx_t MAXIMUM_SIZE = 134217728;
+
+public:
+	//! Create an empty Bloom filter of (at least) the given size in bytes
+	explicit BloomFilter(idx_t size_in_bytes);
+	//! Create a Bloom filter from a bitset that was written earlier (e.g., from a Parquet file)
+	BloomFilter(const_data_ptr_t data, idx_t size_in_bytes);
+
+	//! Returns the size in bytes for a Bloom filter that holds "distinct_values" keys with the given false positive
+	//! rate. The size is a power of two between MINIMUM_SIZE and MAXIMUM_SIZE
+	static idx_t OptimalSize(idx_t distinct_values, double false_positive_rate);
+
+public:
+	//! Insert a single hash into the filter
+	void Insert(hash_t hash);
+	//! Insert "count" hashes into the filter
+	void Insert(Vector &hashes, idx_t count);
+	//! Returns false if the hash is definitely not in the filter, true if it might be
+	bool Lookup(hash_t hash) const;
+	//! Filters the rows in "sel" down to the rows whose hash might be in the filter, returns the remaining count.
+	//! The hashes are indexed by the values in "sel"
+	idx_t Lookup(Vector &hashes, SelectionVector &sel, idx_t count) const;
+	//! Merges another filter of the same size into this filter
+	void Merge(const BloomFilter &other);
+
+	//! The size of the bitset in bytes
+	idx_t SizeInBytes() const {
+		return num_blocks * BLOCK_SIZE;
+	}
+	//! The bitset of the filter
+	const_data_ptr_t Data() const {
+		return const_data_ptr_cast(blocks.get());
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! Allocates (and zero-initializes) the bitset
+	void Initialize(idx_t size_in_bytes);
+	//! Returns the offset (in words) of the block for the given hash
+	inline idx_t BlockOffset(hash_t hash) const {
+		// the upper 32 bits of the hash select the block
+		return ((hash >> 32) * num_blocks >> 32) * WORDS_PER_BLOCK;
+	}
+
+private:
+	//! The number of 256-bit blocks in the filter
+	idx_t num_blocks;
+	//! The bitset
+	unsafe_unique_array<uint32_t> blocks;
+};
+
+} // namespace duckdb
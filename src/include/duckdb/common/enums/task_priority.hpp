@@ -0,0 +1,18 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/task_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The priority with which the tasks of a query are scheduled
+enum class TaskPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+
+} // namespace duckdb
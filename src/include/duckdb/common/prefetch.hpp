@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+//! Hints the CPU to load the cache line containing the address for reading, e.g., to overlap the cache misses of a
+//! batch of hash table lookups before the entries are accessed
+#if __GNUC__
+#define DUCKDB_PREFETCH(address) (__builtin_prefetch(address))
+#else
+#define DUCKDB_PREFETCH(address) ((void)(address))
+#endif
+
+namespace duckdb {
+
+struct HashTablePrefetch {
+	//! Assume (1 << 20) = 1MB L2 cache per core, divided by two because hyperthreading
+	static constexpr const idx_t L2_CACHE_SIZE = 1048576 / 2;
+	//! How many lookups ahead the entries are prefetched: far enough ahead that the loads are in flight concurrently,
+	//! close enough that the cache lines have not been evicted again by the time they are accessed
+	static constexpr const idx_t DISTANCE = 16;
+
+	//! Whether lookups in a hash table of the given size (pointer table plus rows) are dominated by cache misses
+	static bool Enabled(idx_t ht_size_in_bytes) {
+		return ht_size_in_bytes > L2_CACHE_SIZE;
+	}
+};
+
+} // namespace duckdb
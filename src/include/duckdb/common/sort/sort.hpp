@@ -22,6 +22,10 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Merge partitions are never made smaller than this many rows
+	static constexpr idx_t MIN_MERGE_PARTITION_SIZE = 16 * STANDARD_VECTOR_SIZE;
+	//! Number of merge partitions to create per thread, so that threads that finish early can pick up more work
+	static constexpr idx_t MERGE_PARTITIONS_PER_THREAD = 4;
 };
 
 struct SortLayout {
@@ -61,6 +65,10 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Initializes the global sort state for another round of merging, lowering the merge partition size so that
+	//! all threads participate, even if only few pairs of blocks are left to merge.
+	//! The resulting blocks no longer have a uniform size, so this cannot be used with the SBIterator
+	void InitializeMergeRound(idx_t num_threads);
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
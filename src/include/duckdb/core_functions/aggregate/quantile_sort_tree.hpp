@@ -246,6 +246,8 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 	using BaseTree = MergeSortTree<IDX, IDX>;
 	using Elements = typename BaseTree::Elements;
 
+	QuantileSortTree() {
+	}
 	explicit QuantileSortTree(Elements &&lowest_level) : BaseTree(std::move(lowest_level)) {
 	}
 
@@ -276,7 +278,10 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 		QuantileCompare<Accessor> cmp(indirect, bind_data.desc);
 		std::sort(sorted.begin(), sorted.end(), cmp);
 
-		return make_uniq<QuantileSortTree>(std::move(sorted));
+		//	The levels are built by calling Build, possibly from multiple threads
+		auto result = make_uniq<QuantileSortTree>();
+		result->Allocate(std::move(sorted));
+		return result;
 	}
 
 	inline IDX SelectNth(const SubFrames &frames, size_t n) const {
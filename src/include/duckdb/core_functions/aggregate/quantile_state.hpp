@@ -73,7 +73,7 @@ struct QuantileOperation {
 		const auto data = FlatVector::GetData<const INPUT_TYPE>(inputs[0]);
 		const auto &data_mask = FlatVector::Validity(inputs[0]);
 
-		//	Build the tree
+		//	Sort the data and allocate the tree - the levels are built by WindowBuild
 		auto &state = *reinterpret_cast<STATE *>(g_state);
 		auto &window_state = state.GetOrCreateWindowState();
 		if (count < std::numeric_limits<uint32_t>::max()) {
@@ -85,6 +85,21 @@ struct QuantileOperation {
 		}
 	}
 
+	template <class STATE, class INPUT_TYPE>
+	static void WindowBuild(AggregateInputData &aggr_input_data, data_ptr_t g_state) {
+		//	All threads build the levels of the tree (if WindowInit created one)
+		auto &state = *reinterpret_cast<STATE *>(g_state);
+		if (!state.HasTrees()) {
+			return;
+		}
+		auto &window_state = state.GetWindowState();
+		if (window_state.qst32) {
+			window_state.qst32->Build();
+		} else {
+			window_state.qst64->Build();
+		}
+	}
+
 	static idx_t FrameSize(const QuantileIncluded &included, const SubFrames &frames) {
 		//	Count the number of valid values
 		idx_t n = 0;
@@ -44,11 +44,15 @@ public:
 public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static double LOAD_FACTOR = 1.5;
+	//! Capacity above which the HT does not fit into the CPU cache, and entries and rows are prefetched when probing
+	constexpr static idx_t PREFETCH_THRESHOLD = 8192;
 
 	//! Get the layout of this HT
 	const TupleDataLayout &GetLayout() const;
 	//! Number of groups in the HT
 	idx_t Count() const;
+	//! Number of rows that were added to the HT since the count was last reset
+	idx_t SinkCount() const;
 	//! Initial capacity of the HT
 	static idx_t InitialCapacity();
 	//! Capacity that can hold 'count' entries without resizing
@@ -83,8 +87,12 @@ public:
 	void Resize(idx_t size);
 	//! Resets the pointer table of the HT to all 0's
 	void ClearPointerTable();
-	//! Resets the group count to 0
+	//! Resets the group count (and sink count) to 0
 	void ResetCount();
+	//! Whether every added row creates a new group without looking up existing groups
+	bool SkipLookups() const;
+	//! Stop looking up existing groups. Duplicate groups are then only combined when the partitioned data is combined
+	void SetSkipLookups(bool skip_lookups);
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -128,6 +136,10 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! The number of rows added to the HT
+	idx_t sink_count;
+	//! Whether to skip looking up existing groups, and create a new group for every row instead
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -155,6 +167,8 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Creates a new group for every row (used when skipping lookups)
+	idx_t CreateGroupsInternal(DataChunk &groups, Vector &addresses, SelectionVector &new_groups);
 
 	//! Verify the pointer table of the HT
 	void Verify();
@@ -13,8 +13,10 @@
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -30,6 +32,12 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+
+	//! Lock for merging the Bloom filters
+	mutex lock;
+	//! The filters for which we build a Bloom filter while the hash table is finalized, and the Bloom filters
+	vector<idx_t> bloom_filter_idxs;
+	vector<shared_ptr<BloomFilter>> bloom_filters;
 };
 
 struct JoinFilterLocalState {
@@ -40,12 +48,19 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
+	//! Maximum build-side size for which we build a Bloom filter over the join keys
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_SIZE = 4194304;
+	//! The false positive rate of the Bloom filters
+	static constexpr const double BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
+
 	//! The dynamic table filter set where to push filters into
 	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
+	//! Whether or not the probe-side scan can evaluate Bloom filters
+	bool bloom_filter_pushdown = false;
 
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
@@ -53,7 +68,14 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	//! Pushes the min/max filters, and sets up the Bloom filters if the build side is small enough
+	void PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, const PhysicalOperator &op) const;
+	//! Inserts the join keys in the given chunk range of the hash table into the Bloom filters. Called concurrently
+	//! (with "parallel" set) by the tasks that finalize the hash table
+	void BuildBloomFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, idx_t chunk_idx_from, idx_t chunk_idx_to,
+	                       bool parallel) const;
+	//! Pushes the Bloom filters, once they are built
+	void PushBloomFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
@@ -75,6 +75,10 @@ typedef void (*aggregate_window_t)(AggregateInputData &aggr_input_data, const Wi
 typedef void (*aggregate_wininit_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
                                     data_ptr_t g_state);
 
+//! The type used for building the shared windowed aggregate state in parallel (optional). Every thread calls it after
+//! the state has been initialized, and it returns once the state is complete
+typedef void (*aggregate_winbuild_t)(AggregateInputData &aggr_input_data, data_ptr_t g_state);
+
 typedef void (*aggregate_serialize_t)(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
                                       const AggregateFunction &function);
 typedef unique_ptr<FunctionData> (*aggregate_deserialize_t)(Deserializer &deserializer, AggregateFunction &function);
@@ -149,6 +153,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The windowed aggregate custom parallel build function (may be null)
+	aggregate_winbuild_t window_build = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -294,6 +294,12 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function can evaluate Bloom filters (TableFilterType::BLOOM_FILTER) that are pushed
+	//! down from the build side of a hash join
+	bool bloom_filter_pushdown;
+	//! Whether or not the table function can evaluate dynamic filters (TableFilterType::DYNAMIC_FILTER), whose value
+	//! is updated while the scan is running (e.g. the boundary of a Top-N)
+	bool dynamic_filter_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -12,6 +12,8 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/enums/task_priority.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/profiling_info.hpp"
@@ -111,6 +113,13 @@ struct ClientConfig {
 	//! The explain output type used when none is specified (default: PHYSICAL_ONLY)
 	ExplainOutputType explain_output_type = ExplainOutputType::PHYSICAL_ONLY;
 
+	//! The priority with which the tasks of the queries of this connection are scheduled
+	TaskPriority query_priority = TaskPriority::NORMAL;
+	//! The maximum amount of threads a single query of this connection can use (0 = all threads)
+	idx_t max_query_threads = 0;
+	//! The maximum memory a query of this connection can reserve for its intermediates, overrides max_query_memory
+	optional_idx query_memory_limit;
+
 	//! The maximum amount of pivot columns
 	idx_t pivot_limit = 100000;
 
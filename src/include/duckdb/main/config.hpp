@@ -60,6 +60,13 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+enum class TaskSchedulerMode : uint8_t {
+	//! All threads share a single task queue
+	GLOBAL_QUEUE = 0,
+	//! Every NUMA node has its own task queue, threads are pinned to a node and steal tasks from other nodes when idle
+	WORK_STEALING = 1
+};
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -123,6 +130,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The maximum time (in microseconds) a WAL sync waits for concurrently committing transactions (default: 0)
+	idx_t wal_group_commit_delay = 0;
+	//! Whether or not automatic checkpoints are performed by a background thread, instead of by the committing thread
+	bool background_checkpoint = false;
+	//! The maximum amount of bytes per second written by background checkpoints (0 = unlimited)
+	idx_t background_checkpoint_max_write_rate = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -145,6 +158,8 @@ struct DBConfigOptions {
 	string autoinstall_extension_repo = "";
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
+	//! The maximum memory a single query can reserve for its intermediates (in bytes). Default: no limit.
+	idx_t max_query_memory = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
@@ -156,6 +171,8 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress the blocks that are written to the temporary directory
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -192,6 +209,8 @@ struct DBConfigOptions {
 	CompressionType force_compression = CompressionType::COMPRESSION_AUTO;
 	//! Force a specific bitpacking mode to be used when using the bitpacking compression method
 	BitpackingMode force_bitpacking_mode = BitpackingMode::AUTO;
+	//! The number of vectors per column that are used to pick a compression method when checkpointing (0 = all)
+	idx_t compression_analysis_sample_vectors = 16;
 	//! Debug setting for window aggregation mode: (window, combine, separate)
 	WindowAggregationMode window_mode = WindowAggregationMode::WINDOW;
 	//! Whether or not preserving insertion order should be preserved
@@ -216,6 +235,8 @@ struct DBConfigOptions {
 	bool allow_extensions_metadata_mismatch = false;
 	//! Enable emitting FSST Vectors
 	bool enable_fsst_vectors = false;
+	//! Whether to build Bloom filters for the string, blob and uuid columns of row groups when checkpointing
+	bool enable_row_group_bloom_filters = false;
 	//! Enable VIEWs to create dependencies
 	bool enable_view_dependencies = false;
 	//! Enable macros to create dependencies
@@ -234,6 +255,8 @@ struct DBConfigOptions {
 	idx_t allocator_flush_threshold = 134217728;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! How the task scheduler distributes tasks over its threads
+	TaskSchedulerMode scheduler_mode = TaskSchedulerMode::GLOBAL_QUEUE;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -225,6 +225,7 @@ static constexpr ExtensionFunctionEntry EXTENSION_FUNCTIONS[] = {
     {"mysql_query", "mysql_scanner", CatalogType::TABLE_FUNCTION_ENTRY},
     {"netmask", "inet", CatalogType::SCALAR_FUNCTION_ENTRY},
     {"network", "inet", CatalogType::SCALAR_FUNCTION_ENTRY},
+    {"parquet_bloom_probe", "parquet", CatalogType::TABLE_FUNCTION_ENTRY},
     {"parquet_file_metadata", "parquet", CatalogType::TABLE_FUNCTION_ENTRY},
     {"parquet_kv_metadata", "parquet", CatalogType::TABLE_FUNCTION_ENTRY},
     {"parquet_metadata", "parquet", CatalogType::TABLE_FUNCTION_ENTRY},
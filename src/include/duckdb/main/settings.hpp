@@ -72,6 +72,36 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether or not automatic checkpoints are performed by a background thread, instead of at commit";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BackgroundCheckpointMaxWriteRateSetting {
+	static constexpr const char *Name = "background_checkpoint_max_write_rate";
+	static constexpr const char *Description =
+	    "The maximum amount of data per second written by background checkpoints (e.g. 100MB, 0 for unlimited)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "The maximum time (in microseconds) a WAL sync waits for concurrently committing transactions to join it";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -236,6 +266,17 @@ struct EnableFSSTVectors {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableRowGroupBloomFiltersSetting {
+	static constexpr const char *Name = "enable_row_group_bloom_filters";
+	static constexpr const char *Description =
+	    "Build Bloom filters for string, blob and uuid columns of every row group when checkpointing, and use them to "
+	    "skip row groups for equality and IN filters";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowUnsignedExtensionsSetting {
 	static constexpr const char *Name = "allow_unsigned_extensions";
 	static constexpr const char *Description = "Allow to load extensions with invalid or missing signatures";
@@ -450,6 +491,17 @@ struct ForceBitpackingModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CompressionAnalysisSampleVectorsSetting {
+	static constexpr const char *Name = "compression_analysis_sample_vectors";
+	static constexpr const char *Description =
+	    "The number of vectors of a column that are analyzed to pick a compression method when checkpointing, or 0 to "
+	    "analyze all of them";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct HomeDirectorySetting {
 	static constexpr const char *Name = "home_directory";
 	static constexpr const char *Description = "Sets the home directory used by the system";
@@ -509,6 +561,26 @@ struct MaximumExpressionDepthSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MaximumQueryMemorySetting {
+	static constexpr const char *Name = "max_query_memory";
+	static constexpr const char *Description =
+	    "The maximum memory a single query can reserve for its intermediates before it spills to disk (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct MaximumQueryThreadsSetting {
+	static constexpr const char *Name = "max_query_threads";
+	static constexpr const char *Description =
+	    "The maximum amount of threads a single query of this connection can use (0 = all threads)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumMemorySetting {
 	static constexpr const char *Name = "max_memory";
 	static constexpr const char *Description = "The maximum memory of the system (e.g. 1GB)";
@@ -725,6 +797,26 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description = "The maximum memory a query of this connection can reserve for its "
+	                                           "intermediates before it spills to disk, overrides max_query_memory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The priority with which the tasks of the queries of this connection are scheduled (LOW, NORMAL or HIGH)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -763,6 +855,17 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress the blocks that are written to the temp directory (using an adaptively chosen "
+	    "compression level)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -800,6 +903,17 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SchedulerModeSetting {
+	static constexpr const char *Name = "scheduler_mode";
+	static constexpr const char *Description =
+	    "How tasks are distributed over threads: global_queue (a single queue shared by all threads) or work_stealing "
+	    "(a queue per NUMA node, threads are pinned to a node and steal tasks from other nodes when idle)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
@@ -20,6 +21,10 @@ public:
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Push a dynamic filter on the boundary of the Top-N heap into the scan of the first order column (if possible)
+	static void PushdownDynamicFilters(LogicalTopN &op);
 };
 
 } // namespace duckdb
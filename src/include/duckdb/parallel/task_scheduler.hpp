@@ -10,7 +10,9 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/task_priority.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -21,9 +23,27 @@ struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
+enum class TaskSchedulerMode : uint8_t;
 
 struct SchedulerThread;
 
+//! The CPUs of every NUMA node of the system
+struct CPUTopology {
+	//! The CPUs that belong to every node
+	vector<vector<idx_t>> node_cpus;
+	//! The node of every CPU
+	vector<idx_t> cpu_nodes;
+
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+	//! Returns the node of the given CPU
+	idx_t GetNode(idx_t cpu) const;
+
+	//! Detects the NUMA nodes of the system, falls back to a single node with all CPUs
+	static CPUTopology Detect();
+};
+
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
 	~ProducerToken();
@@ -34,6 +54,11 @@ struct ProducerToken {
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
+//! In the WORK_STEALING mode every NUMA node has its own queue. Tasks are scheduled on the queue of the node the
+//! scheduling thread runs on, the background threads are pinned to a node and only steal tasks from the queues of other
+//! nodes when their own queue is empty, so tasks preferentially run near the memory they touch.
+//! Every task priority has its own queues. Idle threads take tasks from the queues of the priorities in a weighted
+//! round-robin, so the tasks of high priority queries are executed first without starving lower priority queries.
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
@@ -45,7 +70,8 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer, whose tasks are scheduled with the given priority
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority = TaskPriority::NORMAL);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -78,6 +104,10 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Sets the scheduler mode, the background threads are relaunched (and pinned) on the next RelaunchThreads call
+	void SetSchedulerMode(TaskSchedulerMode mode);
+	//! Pins the calling thread to the CPUs of a NUMA node, and lets it allocate from an arena of that node
+	void PinThreadToNode(idx_t node);
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
@@ -86,9 +116,13 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Returns the node whose queue the calling thread should use first
+	idx_t GetCurrentNode();
 
 private:
 	DatabaseInstance &db;
+	//! The NUMA nodes of the system
+	CPUTopology topology;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
@@ -105,6 +139,10 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The requested scheduler mode (set by the 'scheduler_mode' setting)
+	atomic<TaskSchedulerMode> requested_mode;
+	//! The scheduler mode of the running background threads
+	TaskSchedulerMode thread_mode;
 };
 
 } // namespace duckdb
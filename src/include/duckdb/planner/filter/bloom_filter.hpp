@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/bloom_filter.hpp"
+
+namespace duckdb {
+
+//! BloomTableFilter filters out rows whose value is definitely not contained in a set of keys, e.g., the keys on the
+//! build side of a hash join. Values that pass the filter might still not be in the set.
+class BloomTableFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomTableFilter(shared_ptr<BloomFilter> filter);
+
+	//! The Bloom filter over the hashes (VectorOperations::Hash) of the keys - shared between copies of this filter
+	shared_ptr<BloomFilter> filter;
+
+public:
+	//! Filters the rows in "sel" down to the non-NULL rows of "keys" that might be in the filter
+	idx_t Filter(Vector &keys, UnifiedVectorFormat &kdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
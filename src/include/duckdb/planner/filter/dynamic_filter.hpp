@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter - the filter value is set (and tightened) by an operator while the scan that
+//! evaluates the filter is running
+struct DynamicFilterData {
+	DynamicFilterData(ExpressionType comparison_type, const LogicalType &type);
+
+	mutable mutex lock;
+	//! The comparison with the current filter value
+	ConstantFilter filter;
+	//! Whether or not a filter value has been set
+	bool initialized = false;
+
+public:
+	//! Sets the filter value if it is more selective than the current value (or if no value has been set yet)
+	void Tighten(const Value &value);
+	//! Clears the filter value - the filter passes all rows until a new value is set
+	void Reset();
+	//! Returns a copy of the current filter, or nullptr if no value has been set yet
+	unique_ptr<ConstantFilter> GetFilter() const;
+};
+
+//! DynamicFilter is a comparison with a constant that can change while the scan is running, e.g., the current
+//! boundary value of a Top-N heap. Until a value is set the filter passes all rows.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter state - nullptr if the filter was deserialized
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	//! Returns a copy of the current filter, or nullptr if the filter currently passes all rows
+	unique_ptr<ConstantFilter> GetFilter() const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -28,7 +28,9 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6,  // probabilistic membership test (e.g. the join keys of a hash join build side)
+	DYNAMIC_FILTER = 7 // comparison with a constant that changes during execution (e.g. the boundary of a top-n)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
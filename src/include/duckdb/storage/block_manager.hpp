@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include "duckdb/common/unordered_map.hpp"
@@ -21,6 +22,7 @@ class BufferManager;
 class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
+class StorageLock;
 
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
@@ -64,6 +66,10 @@ public:
 	}
 	//! Write the header; should be the final step of a checkpoint
 	virtual void WriteHeader(DatabaseHeader header) = 0;
+	//! Limits the rate at which blocks are written (in bytes per second, 0 = unlimited). The limit is lifted once other
+	//! threads wait for "checkpoint_lock" (if set), so that the writes do not keep them waiting for longer
+	virtual void SetWriteRateLimit(idx_t bytes_per_second, optional_ptr<StorageLock> checkpoint_lock = nullptr) {
+	}
 
 	//! Returns the number of total blocks
 	virtual idx_t TotalBlocks() = 0;
@@ -11,18 +11,19 @@
 #include "duckdb/storage/checkpoint_manager.hpp"
 
 namespace duckdb {
-struct BoundCreateTableInfo;
+class PersistentTableData;
 
-//! The table data reader is responsible for reading the data of a table from the block manager
+//! The table data reader is responsible for reading the statistics and row group pointers of a table from the block
+//! manager
 class TableDataReader {
 public:
-	TableDataReader(MetadataReader &reader, BoundCreateTableInfo &info);
+	TableDataReader(MetadataReader &reader, PersistentTableData &data);
 
-	void ReadTableData();
+	void ReadTableData(const vector<LogicalType> &types);
 
 private:
 	MetadataReader &reader;
-	BoundCreateTableInfo &info;
+	PersistentTableData &data;
 };
 
 } // namespace duckdb
@@ -51,6 +51,8 @@ struct DataPointer {
 	BaseStatistics statistics;
 	//! Serialized segment state
 	unique_ptr<ColumnSegmentState> segment_state;
+	//! Statistics of every vector of the row group that (partially) lies within the segment
+	vector<BaseStatistics> vector_statistics;
 
 	void Serialize(Serializer &serializer) const;
 	static DataPointer Deserialize(Deserializer &source);
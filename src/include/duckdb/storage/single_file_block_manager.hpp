@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -69,6 +70,8 @@ public:
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
 	void WriteHeader(DatabaseHeader header) override;
+	//! Limits the rate at which blocks are written (in bytes per second, 0 = unlimited)
+	void SetWriteRateLimit(idx_t bytes_per_second, optional_ptr<StorageLock> checkpoint_lock = nullptr) override;
 	//! Truncate the underlying database file after a checkpoint
 	void Truncate() override;
 
@@ -130,5 +133,19 @@ private:
 	StorageManagerOptions options;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+
+	//! Lock for limiting the write rate
+	mutex write_rate_lock;
+	//! The maximum amount of bytes written per second (0 = unlimited)
+	atomic<idx_t> write_rate_limit;
+	//! The time at which the write rate limit was set, and the amount of bytes written since then
+	std::chrono::steady_clock::time_point write_rate_start;
+	idx_t write_rate_bytes;
+	//! The write rate is no longer limited once other threads wait for this lock
+	optional_ptr<StorageLock> write_rate_checkpoint_lock;
+
+private:
+	//! Waits until "bytes" can be written without exceeding the write rate limit
+	void LimitWriteRate(idx_t bytes);
 };
 } // namespace duckdb
@@ -21,6 +21,8 @@ public:
 
 	//! Type-specific statistics of the segment
 	BaseStatistics statistics;
+	//! Statistics of every vector of the row group that (partially) lies within the segment, empty if unknown
+	vector<BaseStatistics> vector_statistics;
 };
 
 } // namespace duckdb
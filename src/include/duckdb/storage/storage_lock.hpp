@@ -48,6 +48,9 @@ public:
 	//! If this method succeeds, we have **both** a shared and exclusive lock active (which normally is not allowed)
 	//! But this behavior is required for checkpointing
 	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &lock);
+	//! Whether or not there are threads waiting to obtain a shared lock (i.e., waiting for an exclusive lock to be
+	//! released)
+	bool HasWaitingSharedLocks();
 
 private:
 	shared_ptr<StorageLockInternals> internals;
@@ -33,6 +33,13 @@ public:
 
 	//! Revert the commit
 	virtual void RevertCommit() = 0;
+	//! Mark the commit as reverted without modifying the WAL - used when the revert of an earlier commit has already
+	//! removed the entries of this commit from the WAL
+	virtual void MarkReverted() {
+	}
+	//! Write the end of the commit, without making it persistent yet
+	virtual void WriteCommit() {
+	}
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
 };
@@ -40,12 +47,16 @@ public:
 struct CheckpointOptions {
 	CheckpointOptions()
 	    : wal_action(CheckpointWALAction::DONT_DELETE_WAL), action(CheckpointAction::CHECKPOINT_IF_REQUIRED),
-	      type(CheckpointType::FULL_CHECKPOINT) {
+	      type(CheckpointType::FULL_CHECKPOINT), max_write_rate(0) {
 	}
 
 	CheckpointWALAction wal_action;
 	CheckpointAction action;
 	CheckpointType type;
+	//! The maximum amount of bytes per second written by the checkpoint (0 = unlimited)
+	idx_t max_write_rate;
+	//! The checkpoint lock held by the checkpoint - the write rate is not limited while other threads wait for it
+	optional_ptr<StorageLock> checkpoint_lock;
 };
 
 //! StorageManager is responsible for managing the physical storage of the
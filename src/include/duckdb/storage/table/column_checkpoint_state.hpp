@@ -33,6 +33,10 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! Statistics of every vector of the row group that is being written, used as a fine-grained zonemap
+	vector<BaseStatistics> vector_statistics;
+	//! The Bloom filter over the values of the column (if any)
+	shared_ptr<BloomFilter> bloom_filter;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -19,6 +19,7 @@
 #include "duckdb/common/enums/scan_vector_type.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -68,6 +69,8 @@ public:
 
 public:
 	virtual FilterPropagateResult CheckZonemap(ColumnScanState &state, TableFilter &filter);
+	//! Checks the filter against the statistics of a single vector of the segment that is being scanned
+	FilterPropagateResult CheckVectorZonemap(ColumnScanState &state, TableFilter &filter, idx_t vector_index);
 
 	BlockManager &GetBlockManager() {
 		return block_manager;
@@ -155,6 +158,8 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
+	//! Whether or not a Bloom filter is built for columns of the given type when checkpointing
+	static bool SupportsBloomFilter(const LogicalType &type);
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -193,12 +198,15 @@ protected:
 	ColumnSegmentTree data;
 	//! The lock for the updates
 	mutable mutex update_lock;
-	//! The updates for this column segment
-	unique_ptr<UpdateSegment> updates;
+	//! The updates for this column segment - shared with fetches that are in progress while the updates are cleared
+	shared_ptr<UpdateSegment> updates;
 	//! The lock for the stats
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The Bloom filter over the values of the column (if any) - protected by the stats lock. The filter is dropped
+	//! when the column is appended to or updated
+	shared_ptr<BloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -16,6 +16,10 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! The false positive rate of the Bloom filters that are built for row groups
+	static constexpr const double BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -31,9 +35,24 @@ public:
 	CompressionFunction &GetCompressionFunction(CompressionType type);
 
 private:
-	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	//! Scans the vectors of the segments, skipping the vectors for which the filter (if any) returns false
+	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback,
+	                  const std::function<bool(idx_t)> &scan_vector_filter = nullptr);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
+	//! The compression method that the previous checkpoint used for all of the data (if any)
+	idx_t GetPreviousCompressionMethod();
+	//! The compression method that compresses a sample of the vectors best (if the column is large enough to sample)
+	idx_t DetectBestCompressionMethodSampled();
+	//! Runs the analysis of a single compression method over all of the data, or returns nullptr if it cannot be used
+	unique_ptr<AnalyzeState> AnalyzeCompressionMethod(idx_t compression_idx);
 	void WriteToDisk();
+	//! Whether or not statistics are gathered for every vector of the column
+	bool HasVectorStatistics();
+	void UpdateVectorStatistics(Vector &scan_vector, idx_t row_idx, idx_t count);
+	//! Whether or not a Bloom filter is built over the values of the column
+	bool HasBloomFilter();
+	void GatherBloomFilterHashes(Vector &scan_vector, idx_t count, vector<hash_t> &result);
+	shared_ptr<BloomFilter> CreateBloomFilter(vector<hash_t> &hashes);
 	bool HasChanges();
 	void WritePersistentSegments();
 
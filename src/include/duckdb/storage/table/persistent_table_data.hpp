@@ -26,6 +26,9 @@ public:
 	idx_t total_rows;
 	idx_t row_group_count;
 	MetaBlockPointer block_pointer;
+	//! The location of the table statistics and row group pointers - if set, these have not been read yet and are
+	//! read on first access of the table data
+	MetaBlockPointer table_pointer;
 };
 
 } // namespace duckdb
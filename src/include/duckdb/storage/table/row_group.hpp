@@ -193,6 +193,8 @@ private:
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
 	idx_t allocation_size;
+	//! The number of times the row group has been written to disk - every write replaces the segments of its columns
+	atomic<idx_t> write_count;
 };
 
 } // namespace duckdb
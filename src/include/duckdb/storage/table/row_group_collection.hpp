@@ -43,6 +43,8 @@ public:
 
 	void Initialize(PersistentTableData &data);
 	void InitializeEmpty();
+	//! Reads the table statistics and row group pointers of a collection that was initialized lazily
+	void LoadTableData();
 
 	bool IsEmpty() const;
 
@@ -127,6 +129,8 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Returns the table statistics, reading them first if required
+	TableStatistics &GetTableStatistics();
 
 private:
 	//! BlockManager
@@ -144,6 +148,12 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! Lock for reading the table data on first access
+	mutex table_data_lock;
+	//! Whether or not the table statistics and row group pointers have been read
+	atomic<bool> table_data_loaded;
+	//! The location of the table statistics and row group pointers, if they have not been read yet
+	MetaBlockPointer table_data_pointer;
 };
 
 } // namespace duckdb
@@ -22,6 +22,8 @@ public:
 	~RowGroupSegmentTree() override;
 
 	void Initialize(PersistentTableData &data);
+	//! Initializes the tree for a collection whose row group pointers have not been read yet
+	void InitializeLazy();
 
 protected:
 	unique_ptr<RowGroup> LoadSegment() override;
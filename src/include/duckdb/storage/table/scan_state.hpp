@@ -88,6 +88,9 @@ struct ColumnScanState {
 	bool initialized = false;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
+	//! Whether the column had updates when the scan was initialized - if not, vectors can be skipped based on their
+	//! statistics without checking for updates
+	bool has_updates = true;
 	//! We initialize one SegmentScanState per segment, however, if scanning a DataChunk requires us to scan over more
 	//! than one Segment, we need to keep the scan states of the previous segments around
 	vector<unique_ptr<SegmentScanState>> previous_states;
@@ -177,6 +180,8 @@ public:
 	idx_t vector_index;
 	//! The maximum row within the row group
 	idx_t max_row_group_row;
+	//! The write count of the row group when its scan was initialized
+	idx_t row_group_write_count;
 	//! Child column scans
 	unsafe_unique_array<ColumnScanState> column_scans;
 	//! Row group segment tree
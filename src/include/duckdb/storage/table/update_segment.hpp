@@ -30,7 +30,7 @@ public:
 public:
 	bool HasUpdates() const;
 	bool HasUncommittedUpdates(idx_t vector_index);
-	bool HasUpdates(idx_t vector_index) const;
+	bool HasUpdates(idx_t vector_index);
 	bool HasUpdates(idx_t start_row_idx, idx_t end_row_idx);
 
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result);
@@ -45,21 +45,24 @@ public:
 	void CleanupUpdate(UpdateInfo &info);
 
 	unique_ptr<BaseStatistics> GetStatistics();
-	StringHeap &GetStringHeap() {
-		return heap;
-	}
+	//! Copies a (non-inlined) string into the string heap of the segment
+	string_t AddStringToHeap(const string_t &str);
 
 private:
-	//! The lock for the update segment
-	StorageLock lock;
-	//! The root node (if any)
+	//! The locks for the version chains of the individual vectors - updates to different vectors can run concurrently
+	StorageLock vector_locks[Storage::ROW_GROUP_VECTOR_COUNT];
+	//! The root node
 	unique_ptr<UpdateNode> root;
+	//! Whether or not any updates have been made to the segment
+	atomic<bool> has_updates;
 	//! Update statistics
 	SegmentStatistics stats;
 	//! Stats lock
 	mutex stats_lock;
 	//! Internal type size
 	idx_t type_size;
+	//! Heap lock
+	mutex heap_lock;
 	//! String heap, only used for strings
 	StringHeap heap;
 
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +45,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size of a block (only used to track the size on disk)
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -66,6 +68,45 @@ public:
 	bool IsValid() const;
 };
 
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+//! The compression level of a block that is written to a temporary file. Negative ZSTD levels trade compression ratio
+//! for speed (comparable to LZ4)
+enum class TemporaryCompressionLevel : int8_t { ZSTD_MINUS_THREE = -3, UNCOMPRESSED = 0, ZSTD_ONE = 1 };
+
+//! Chooses the compression level of the blocks that are written to the temporary files, based on how long it took to
+//! compress and write previous blocks with each of the levels. Blocks that do not compress well take as long to write
+//! as uncompressed blocks (plus the time spent compressing them), so they steer the choice towards UNCOMPRESSED
+class TemporaryFileCompressionAdaptivity {
+public:
+	TemporaryFileCompressionAdaptivity();
+
+public:
+	//! Returns the current time in nanoseconds, used as the start of a measurement
+	static int64_t GetCurrentTimeNanos();
+	//! Returns the level to compress the next block with
+	TemporaryCompressionLevel GetCompressionLevel();
+	//! Registers how long it took to compress and write a block with the given level
+	void Update(TemporaryCompressionLevel level, int64_t time_before_ns);
+
+private:
+	static idx_t LevelToIndex(TemporaryCompressionLevel level);
+	static TemporaryCompressionLevel IndexToLevel(idx_t index);
+
+private:
+	//! The number of levels we choose from
+	static constexpr idx_t LEVELS = 3;
+	//! Every EXPLORATION_INTERVAL blocks we pick the next level in line (instead of the fastest one), so that the
+	//! measurements of all levels stay up-to-date
+	static constexpr idx_t EXPLORATION_INTERVAL = 16;
+	//! The number of blocks that we have written
+	atomic<idx_t> block_count;
+	//! The (exponential moving) average time it takes to compress and write a block per level, 0 if not measured yet
+	atomic<int64_t> average_time_ns[LEVELS];
+};
+
 //===--------------------------------------------------------------------===//
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
@@ -75,7 +116,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +129,12 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a block to the slot of the given index, this is either the buffer itself, or (if the slots of this file
+	//! are smaller than a block) the compressed buffer
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slots in this file
+	idx_t GetSlotSize() const;
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -101,6 +146,8 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	//! The size of the slots in this file, compressed blocks are written to files with smaller slots
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
@@ -164,6 +211,8 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	//! Compresses the buffer (if enabled), and returns the size of the slot it should be written to
+	idx_t CompressBuffer(TemporaryCompressionLevel level, FileBuffer &buffer, AllocatedData &compressed_buffer);
 
 private:
 	DatabaseInstance &db;
@@ -180,6 +229,8 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! Chooses the compression level of the blocks we write
+	TemporaryFileCompressionAdaptivity compression_adaptivity;
 };
 
 } // namespace duckdb
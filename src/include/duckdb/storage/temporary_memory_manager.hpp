@@ -24,7 +24,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -48,6 +49,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client whose query this state belongs to
+	ClientContext &context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -61,6 +64,9 @@ private:
 
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
 //! to concurrent states, such that their combined memory usage does not exceed the limit
+//! The reservations of the states of a single query are also kept within the memory limit of the query
+//! (max_query_memory/query_memory_limit), so a query that exceeds its budget spills its own intermediates, instead
+//! of taking memory from other queries
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
@@ -94,7 +100,7 @@ private:
 	unique_lock<mutex> Lock();
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
-	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
+	//! Update memory_limit, has_temporary_directory, num_threads, and query_max_memory (must hold the lock)
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
 	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
@@ -102,6 +108,8 @@ private:
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
+	//! Get the sum of reservations of the active states of the query of a client (must hold the lock)
+	idx_t GetQueryReservation(ClientContext &context) const;
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeOptimalReservation(const TemporaryMemoryState &temporary_memory_state, idx_t free_memory,
 	                                idx_t lower_bound, idx_t upper_bound) const;
@@ -118,7 +126,7 @@ private:
 	bool has_temporary_directory;
 	//! Number of threads
 	idx_t num_threads;
-	//! Max memory per query
+	//! Max memory per query (of the client that last updated the configuration)
 	idx_t query_max_memory;
 
 	//! Currently active states
@@ -127,6 +135,8 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+	//! The sum of reservations of the active states of every query
+	reference_map_t<ClientContext, idx_t> query_reservations;
 };
 
 } // namespace duckdb
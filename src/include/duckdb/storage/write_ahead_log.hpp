@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -110,7 +112,14 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Writes the end of a commit to the WAL and syncs it
 	void Flush();
+	//! Writes the end of a commit to the WAL and hands the written entries to the OS, without syncing them. Returns the
+	//! position up to which the WAL has to be synced for the commit to be durable.
+	idx_t WriteCommit();
+	//! Syncs the WAL up to (at least) "commit_offset". A single sync makes every commit written before it durable, so
+	//! transactions that commit concurrently share their syncs (group commit)
+	void SyncCommit(idx_t commit_offset);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -121,6 +130,19 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+	//! Lock and condition variable used to share syncs between committing transactions
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! Whether or not a thread is currently syncing the WAL
+	bool sync_in_progress;
+	//! The position up to which the WAL has been handed to the OS
+	atomic<idx_t> written_offset;
+	//! The position up to which the WAL has been synced
+	idx_t synced_offset;
+	//! The position up to which the last failed sync tried to sync the WAL, and the error it failed with
+	idx_t failed_offset;
+	string sync_error;
 };
 
 } // namespace duckdb
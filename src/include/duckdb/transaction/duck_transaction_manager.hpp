@@ -11,6 +11,9 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class DuckTransaction;
@@ -58,6 +61,9 @@ public:
 	void PushCatalogEntry(Transaction &transaction_p, CatalogEntry &entry, data_ptr_t extra_data = nullptr,
 	                      idx_t extra_data_size = 0);
 
+	//! Stops the background checkpointer (if it is running), waiting for a running checkpoint to finish
+	void StopBackgroundCheckpointer();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -80,6 +86,14 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Requests a checkpoint from the background checkpointer, starting it if it is not running yet
+	void ScheduleBackgroundCheckpoint();
+	//! The main loop of the background checkpointer
+	void RunBackgroundCheckpointer();
+	//! Performs a checkpoint on the background checkpointer - returns false if there are active writers
+	bool TryBackgroundCheckpoint();
+	//! Signals a waiting background checkpointer that a transaction has finished, so it can retry the checkpoint
+	void NotifyBackgroundCheckpointer();
 
 private:
 	//! The current start timestamp used by transactions
@@ -106,10 +120,38 @@ private:
 	mutex start_transaction_lock;
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
+	//! The commit order of transactions that have written to the WAL, handed out under the WAL lock. Transactions are
+	//! committed in memory in the same order as their commits appear in the WAL.
+	idx_t next_commit_order = 0;
+	//! Commits with an order below this were removed from the WAL by the revert of an earlier commit, and the order of
+	//! the next transaction that is allowed to commit in memory (both protected by the transaction lock)
+	idx_t reverted_commit_order = 0;
+	idx_t current_commit_order = 0;
+	//! The reverted commits are rolled back in reverse order - the commit below this one is rolled back next
+	idx_t next_rollback_order = 0;
+	//! Signals that the transaction with "current_commit_order" can commit in memory, or that the transaction below
+	//! "next_rollback_order" can be rolled back
+	std::condition_variable commit_order_cv;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
 
+	//! Lock for the state of the background checkpointer
+	mutex checkpointer_lock;
+	//! Signals the background checkpointer that a checkpoint was requested or that it should shut down
+	std::condition_variable checkpointer_cv;
+	//! Whether or not a background checkpoint was requested
+	bool checkpoint_requested = false;
+	//! Whether or not the background checkpointer was stopped
+	bool checkpointer_stopped = false;
+	//! Whether or not a transaction finished since the background checkpointer last failed to checkpoint
+	bool transaction_finished = false;
+	//! Whether or not updates or dropped catalog entries were committed since the last background checkpoint - these
+	//! are cleaned up by a checkpoint, so it has to wait for older transactions (protected by the transaction lock)
+	bool has_unsafe_changes = false;
+	//! The background checkpointer thread, started when the first background checkpoint is requested
+	unique_ptr<thread> checkpointer_thread;
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
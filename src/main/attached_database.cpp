@@ -216,6 +216,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// the background checkpointer must not checkpoint while (or after) the database is closed
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpointer();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
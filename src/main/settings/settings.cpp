@@ -95,6 +95,59 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpoint Max Write Rate
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointMaxWriteRateSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto max_write_rate = DBConfig::ParseMemoryLimit(input.ToString());
+	if (max_write_rate == NumericLimits<idx_t>::Maximum()) {
+		// no limit
+		max_write_rate = 0;
+	}
+	config.options.background_checkpoint_max_write_rate = max_write_rate;
+}
+
+void BackgroundCheckpointMaxWriteRateSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint_max_write_rate = DBConfig().options.background_checkpoint_max_write_rate;
+}
+
+Value BackgroundCheckpointMaxWriteRateSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.background_checkpoint_max_write_rate));
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WALGroupCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -485,6 +538,22 @@ Value EnableFSSTVectors::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_fsst_vectors);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Row Group Bloom Filters
+//===--------------------------------------------------------------------===//
+void EnableRowGroupBloomFiltersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_row_group_bloom_filters = input.GetValue<bool>();
+}
+
+void EnableRowGroupBloomFiltersSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_row_group_bloom_filters = DBConfig().options.enable_row_group_bloom_filters;
+}
+
+Value EnableRowGroupBloomFiltersSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_row_group_bloom_filters);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Unsigned Extensions
 //===--------------------------------------------------------------------===//
@@ -1009,6 +1078,22 @@ Value ForceBitpackingModeSetting::GetSetting(const ClientContext &context) {
 	return Value(BitpackingModeToString(context.db->config.options.force_bitpacking_mode));
 }
 
+//===--------------------------------------------------------------------===//
+// Compression Analysis Sample Vectors
+//===--------------------------------------------------------------------===//
+void CompressionAnalysisSampleVectorsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.compression_analysis_sample_vectors = input.GetValue<idx_t>();
+}
+
+void CompressionAnalysisSampleVectorsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compression_analysis_sample_vectors = DBConfig().options.compression_analysis_sample_vectors;
+}
+
+Value CompressionAnalysisSampleVectorsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(*context.db);
+	return Value::UBIGINT(config.options.compression_analysis_sample_vectors);
+}
+
 //===--------------------------------------------------------------------===//
 // Home Directory
 //===--------------------------------------------------------------------===//
@@ -1122,6 +1207,40 @@ Value MaximumExpressionDepthSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(ClientConfig::GetConfig(context).max_expression_depth);
 }
 
+//===--------------------------------------------------------------------===//
+// Maximum Query Memory
+//===--------------------------------------------------------------------===//
+void MaximumQueryMemorySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.max_query_memory = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void MaximumQueryMemorySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.max_query_memory = DBConfig().options.max_query_memory;
+}
+
+Value MaximumQueryMemorySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.max_query_memory == DConstants::INVALID_INDEX) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.options.max_query_memory));
+}
+
+//===--------------------------------------------------------------------===//
+// Maximum Query Threads
+//===--------------------------------------------------------------------===//
+void MaximumQueryThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).max_query_threads = ClientConfig().max_query_threads;
+}
+
+void MaximumQueryThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).max_query_threads = input.GetValue<uint64_t>();
+}
+
+Value MaximumQueryThreadsSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).max_query_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Memory
 //===--------------------------------------------------------------------===//
@@ -1559,6 +1678,64 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (query_memory_limit == DConstants::INVALID_INDEX) {
+		// an invalid index indicates that the limit of max_query_memory is used, use one lower for "unlimited"
+		query_memory_limit--;
+	}
+	ClientConfig::GetConfig(context).query_memory_limit = query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.query_memory_limit.IsValid()) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit.GetIndex()));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "low") {
+		ClientConfig::GetConfig(context).query_priority = TaskPriority::LOW;
+	} else if (parameter == "normal") {
+		ClientConfig::GetConfig(context).query_priority = TaskPriority::NORMAL;
+	} else if (parameter == "high") {
+		ClientConfig::GetConfig(context).query_priority = TaskPriority::HIGH;
+	} else {
+		throw InvalidInputException("Unrecognized option for query_priority \"%s\", expected LOW, NORMAL or HIGH",
+		                            parameter);
+	}
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).query_priority) {
+	case TaskPriority::LOW:
+		return "low";
+	case TaskPriority::NORMAL:
+		return "normal";
+	case TaskPriority::HIGH:
+		return "high";
+	default:
+		throw InternalException("Unrecognized query priority");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1643,6 +1820,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1730,6 +1923,42 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Scheduler Mode
+//===--------------------------------------------------------------------===//
+void SchedulerModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto mode = StringUtil::Lower(input.ToString());
+	if (mode == "global_queue") {
+		config.options.scheduler_mode = TaskSchedulerMode::GLOBAL_QUEUE;
+	} else if (mode == "work_stealing") {
+		config.options.scheduler_mode = TaskSchedulerMode::WORK_STEALING;
+	} else {
+		throw InvalidInputException("Unrecognized option for scheduler_mode, expected global_queue or work_stealing");
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetSchedulerMode(config.options.scheduler_mode);
+	}
+}
+
+void SchedulerModeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scheduler_mode = DBConfig().options.scheduler_mode;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetSchedulerMode(config.options.scheduler_mode);
+	}
+}
+
+Value SchedulerModeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.scheduler_mode) {
+	case TaskSchedulerMode::GLOBAL_QUEUE:
+		return "global_queue";
+	case TaskSchedulerMode::WORK_STEALING:
+		return "work_stealing";
+	default:
+		throw InternalException("Type not implemented for TaskSchedulerMode");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
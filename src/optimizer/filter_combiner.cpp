@@ -11,6 +11,7 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -435,6 +436,33 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
+//! Pushes a small IN-list as an OR of equality filters into the scan, so that the scan can use it to skip row groups
+//! (e.g., through zone maps or Parquet Bloom filters)
+static bool PushInListFilter(TableFilterSet &table_filters, idx_t column_index, BoundOperatorExpression &func) {
+	static constexpr const idx_t MAX_IN_LIST_FILTER_SIZE = 32;
+	if (func.children.size() - 1 > MAX_IN_LIST_FILTER_SIZE) {
+		return false;
+	}
+	auto &column_type = func.children[0]->return_type;
+	auto physical_type = column_type.InternalType();
+	if (!TypeIsNumeric(physical_type) && physical_type != PhysicalType::VARCHAR &&
+	    physical_type != PhysicalType::BOOL) {
+		return false;
+	}
+	auto or_filter = make_uniq<ConjunctionOrFilter>();
+	for (idx_t i = 1; i < func.children.size(); i++) {
+		auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+		if (const_value_expr.value.IsNull() || const_value_expr.value.type() != column_type) {
+			return false;
+		}
+		or_filter->child_filters.push_back(
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, const_value_expr.value));
+	}
+	table_filters.PushFilter(column_index, std::move(or_filter));
+	table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+	return true;
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
@@ -581,7 +609,12 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 
 			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
 			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			// IN-lists over other types (strings, UUIDs, ...) are pushed as an OR of equality filters instead, other
+			// IN-lists over integers are left to the IN clause rewriter
 			if (!type.IsIntegral()) {
+				if (PushInListFilter(table_filters, column_index, func)) {
+					remaining_filters.erase_at(rem_fil_idx);
+				}
 				continue;
 			}
 
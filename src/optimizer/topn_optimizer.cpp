@@ -1,8 +1,12 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +36,95 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the boundary of the heap is only set once it is full
+	// rows that sort after the boundary on the first order column can never make it into the result
+	auto &order = op.orders[0];
+	if (op.limit == 0 || order.null_order != OrderByNullType::NULLS_LAST) {
+		// with NULLS FIRST, NULL values sort before the boundary - but the comparison filter would remove them
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	if (!SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	// find the scan that produces the column - filters and projections do not affect which rows can be in the top-n
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			break;
+		}
+		default:
+			return;
+		}
+		child = *child.get().children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.filter_pushdown ||
+	    !get.function.dynamic_filter_pushdown) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || IsRowIdColumnId(column_ids[binding.column_index])) {
+		return;
+	}
+	// with a single order column, rows that are equal to the boundary can be filtered as well
+	bool single_order = op.orders.size() == 1;
+	ExpressionType comparison_type;
+	if (order.type == OrderType::ASCENDING) {
+		comparison_type = single_order ? ExpressionType::COMPARE_LESSTHAN : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	} else {
+		comparison_type =
+		    single_order ? ExpressionType::COMPARE_GREATERTHAN : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	}
+	op.dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type, order.expression->return_type);
+	get.table_filters.PushFilter(column_ids[binding.column_index], make_uniq<DynamicFilter>(op.dynamic_filter));
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,6 +155,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
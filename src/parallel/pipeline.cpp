@@ -114,6 +114,11 @@ bool Pipeline::ScheduleParallel(shared_ptr<Event> &event) {
 	auto max_threads = source_state->MaxThreads();
 	auto &scheduler = TaskScheduler::GetScheduler(executor.context);
 	auto active_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto max_query_threads = ClientConfig::GetConfig(executor.context).max_query_threads;
+	if (max_query_threads > 0 && max_query_threads < active_threads) {
+		// the amount of threads a query can use is limited
+		active_threads = max_query_threads;
+	}
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
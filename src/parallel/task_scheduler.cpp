@@ -3,9 +3,12 @@
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
+#include <algorithm>
+
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
 #include "duckdb/common/thread.hpp"
@@ -23,6 +26,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && defined(_GNU_SOURCE) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#define DUCKDB_PIN_THREADS
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -38,50 +46,126 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The share of the dequeues that first look at the tasks of every priority (LOW, NORMAL, HIGH)
+static constexpr const idx_t PRIORITY_WEIGHTS[] = {1, 4, 16};
+static constexpr const idx_t PRIORITY_COUNT = 3;
+static constexpr const idx_t PRIORITY_WEIGHT_SUM = 21;
+
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	explicit ConcurrentQueue(idx_t node_count);
+
+	idx_t node_count;
+	//! The queue of every priority and NUMA node, indexed by priority * node_count + node
+	vector<unique_ptr<concurrent_queue_t>> queues;
 	lightweight_semaphore_t semaphore;
+	//! The number of dequeues, used to spread the dequeues over the priorities according to their weight
+	atomic<idx_t> dequeue_count;
+
+	concurrent_queue_t &GetQueue(TaskPriority priority, idx_t node) {
+		return *queues[static_cast<idx_t>(priority) * node_count + node];
+	}
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, idx_t node);
+	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task, idx_t node);
+	//! Dequeues a task, the tasks of higher priorities are preferred but lower priorities still get a share of the
+	//! dequeues, so they are never starved. Within a priority, the queue of "node" is tried first, and tasks are stolen
+	//! from the queues of the other nodes if it is empty
+	bool Dequeue(shared_ptr<Task> &task, idx_t node);
+	bool DequeueWithPriority(shared_ptr<Task> &task, TaskPriority priority, idx_t node);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority) : priority(priority) {
+		for (idx_t node = 0; node < queue.node_count; node++) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(queue.GetQueue(priority, node)));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! The priority of the tasks of this producer
+	TaskPriority priority;
+	//! A token for the queue of every NUMA node of the priority
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+ConcurrentQueue::ConcurrentQueue(idx_t node_count) : node_count(node_count), dequeue_count(0) {
+	for (idx_t i = 0; i < PRIORITY_COUNT * node_count; i++) {
+		queues.push_back(make_uniq<concurrent_queue_t>());
+	}
+}
+
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, idx_t node) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	auto &queue_token = *token.token->queue_tokens[node];
+	if (GetQueue(token.token->priority, node).enqueue(queue_token, std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task, idx_t node) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	for (idx_t i = 0; i < node_count; i++) {
+		auto victim = (node + i) % node_count;
+		auto &queue = GetQueue(token.token->priority, victim);
+		if (queue.try_dequeue_from_producer(*token.token->queue_tokens[victim], task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::DequeueWithPriority(shared_ptr<Task> &task, TaskPriority priority, idx_t node) {
+	for (idx_t i = 0; i < node_count; i++) {
+		auto victim = (node + i) % node_count;
+		if (GetQueue(priority, victim).try_dequeue(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task, idx_t node) {
+	// weighted round-robin: pick the priority that is tried first
+	auto slot = dequeue_count++ % PRIORITY_WEIGHT_SUM;
+	idx_t first_priority = PRIORITY_COUNT - 1;
+	for (; first_priority > 0; first_priority--) {
+		if (slot < PRIORITY_WEIGHTS[first_priority]) {
+			break;
+		}
+		slot -= PRIORITY_WEIGHTS[first_priority];
+	}
+	if (DequeueWithPriority(task, static_cast<TaskPriority>(first_priority), node)) {
+		return true;
+	}
+	// the picked priority has no tasks: fall back to the other priorities, from high to low
+	for (idx_t p = PRIORITY_COUNT; p > 0; p--) {
+		auto priority = p - 1;
+		if (priority != first_priority && DequeueWithPriority(task, static_cast<TaskPriority>(priority), node)) {
+			return true;
+		}
+	}
+	return false;
 }
 
 #else
 struct ConcurrentQueue {
+	explicit ConcurrentQueue(idx_t node_count) {
+	}
+
 	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, idx_t node);
+	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task, idx_t node);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, idx_t node) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task, idx_t node) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
@@ -92,11 +176,89 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority) {
 	}
 };
 #endif
 
+idx_t CPUTopology::GetNode(idx_t cpu) const {
+	if (cpu < cpu_nodes.size()) {
+		return cpu_nodes[cpu];
+	}
+	// the estimated CPU id can be a thread id on platforms that do not expose the CPU
+	return cpu % NodeCount();
+}
+
+#ifdef __linux__
+//! Parses a Linux CPU list, e.g. "0-3,8-11"
+static vector<idx_t> ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(StringUtil::Replace(cpu_list, "\n", ""), ",")) {
+		auto bounds = StringUtil::Split(range, "-");
+		if (bounds.empty() || bounds.size() > 2) {
+			return vector<idx_t>();
+		}
+		auto start = std::stoull(bounds[0]);
+		auto end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+		for (auto cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+#endif
+
+CPUTopology CPUTopology::Detect() {
+	CPUTopology result;
+#ifdef __linux__
+	// the nodes and their CPUs are listed in /sys/devices/system/node/node<n>/cpulist
+	try {
+		auto fs = FileSystem::CreateLocal();
+		const string node_directory = "/sys/devices/system/node";
+		vector<idx_t> nodes;
+		if (fs->DirectoryExists(node_directory)) {
+			fs->ListFiles(node_directory, [&](const string &name, bool is_directory) {
+				if (!is_directory || !StringUtil::StartsWith(name, "node") || name.size() == 4 ||
+				    !StringUtil::CharacterIsDigit(name[4])) {
+					return;
+				}
+				nodes.push_back(std::stoull(name.substr(4)));
+			});
+		}
+		std::sort(nodes.begin(), nodes.end());
+		for (auto node : nodes) {
+			auto path = node_directory + "/node" + to_string(node) + "/cpulist";
+			auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (!handle) {
+				continue;
+			}
+			char buffer[4096];
+			auto bytes_read = fs->Read(*handle, buffer, sizeof(buffer));
+			auto cpus = ParseCPUList(string(buffer, NumericCast<idx_t>(bytes_read)));
+			if (cpus.empty()) {
+				// nodes without CPUs (e.g. memory-only nodes) do not get a queue
+				continue;
+			}
+			auto node_idx = result.node_cpus.size();
+			for (auto cpu : cpus) {
+				if (cpu >= result.cpu_nodes.size()) {
+					result.cpu_nodes.resize(cpu + 1, 0);
+				}
+				result.cpu_nodes[cpu] = node_idx;
+			}
+			result.node_cpus.push_back(std::move(cpus));
+		}
+	} catch (std::exception &ex) {
+		result = CPUTopology();
+	}
+#endif
+	if (result.node_cpus.empty()) {
+		result.node_cpus.emplace_back();
+		result.cpu_nodes.clear();
+	}
+	return result;
+}
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
@@ -105,10 +267,11 @@ ProducerToken::~ProducerToken() {
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), topology(CPUTopology::Detect()), queue(make_uniq<ConcurrentQueue>(topology.NodeCount())),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), requested_mode(db.config.options.scheduler_mode),
+      thread_mode(db.config.options.scheduler_mode) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -130,18 +293,25 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority) {
+	auto token = make_uniq<QueueProducerToken>(*queue, priority);
 	return make_uniq<ProducerToken>(*this, std::move(token));
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(token, std::move(task), GetCurrentNode());
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	return queue->DequeueFromProducer(token, task, GetCurrentNode());
+}
+
+idx_t TaskScheduler::GetCurrentNode() {
+	if (requested_mode != TaskSchedulerMode::WORK_STEALING || topology.NodeCount() == 1) {
+		return 0;
+	}
+	return topology.GetNode(GetEstimatedCPUId());
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
@@ -164,7 +334,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task, GetCurrentNode())) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -197,7 +367,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task, GetCurrentNode())) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -227,7 +397,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task, GetCurrentNode())) {
 			return;
 		}
 		try {
@@ -254,7 +424,10 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, optional_idx node) {
+	if (node.IsValid()) {
+		scheduler->PinThreadToNode(node.GetIndex());
+	}
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -292,6 +465,25 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetSchedulerMode(TaskSchedulerMode mode) {
+	requested_mode = mode;
+}
+
+void TaskScheduler::PinThreadToNode(idx_t node) {
+#ifdef DUCKDB_PIN_THREADS
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : topology.node_cpus[node]) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// failing to pin the thread (e.g. because the node's CPUs are not available to the process) is not an error
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+#endif
+	Allocator::SetThreadNode(node);
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -336,6 +528,12 @@ idx_t TaskScheduler::GetEstimatedCPUId() {
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
+	auto mode = requested_mode.load();
+	if (mode != thread_mode) {
+		// threads are pinned when they are launched, so we relaunch all of them when the mode changes
+		RelaunchThreadsInternal(0);
+		thread_mode = mode;
+	}
 	RelaunchThreadsInternal(n);
 }
 
@@ -365,11 +563,16 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		// we are increasing the number of threads: launch them and run tasks on them
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
+			// in the work stealing mode the threads are distributed over the NUMA nodes in a round-robin fashion
+			optional_idx node;
+			if (thread_mode == TaskSchedulerMode::WORK_STEALING && topology.NodeCount() > 1) {
+				node = threads.size() % topology.NodeCount();
+			}
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), node);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
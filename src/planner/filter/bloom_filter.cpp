@@ -0,0 +1,129 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor_state.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+BloomTableFilter::BloomTableFilter(shared_ptr<BloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+}
+
+idx_t BloomTableFilter::Filter(Vector &keys, UnifiedVectorFormat &kdata, SelectionVector &sel,
+                               idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// NULL values never match - remove them first
+	if (!kdata.validity.AllValid()) {
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			sel.set_index(valid_count, idx);
+			valid_count += kdata.validity.RowIsValid(kdata.sel->get_index(idx));
+		}
+		approved_tuple_count = valid_count;
+		if (approved_tuple_count == 0) {
+			return 0;
+		}
+	}
+	// hash only the rows that are still approved - the other rows might not have been decoded
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(keys, hashes, sel, approved_tuple_count);
+	approved_tuple_count = filter->Lookup(hashes, sel, approved_tuple_count);
+	return approved_tuple_count;
+}
+
+FilterPropagateResult BloomTableFilter::CheckStatistics(BaseStatistics &stats) {
+	// the Bloom filter says nothing about the value range
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomTableFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomTableFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomTableFilter>();
+	return other.filter == filter;
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Copy() const {
+	return make_uniq<BloomTableFilter>(filter);
+}
+
+struct BloomFilterLookupData : public FunctionData {
+	explicit BloomFilterLookupData(const BloomTableFilter &filter_p) : filter(filter_p.filter) {
+	}
+
+	BloomTableFilter filter;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<BloomFilterLookupData>(filter);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<BloomFilterLookupData>();
+		return filter.Equals(other.filter);
+	}
+};
+
+static void BloomFilterLookupFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<BloomFilterLookupData>();
+
+	const auto count = args.size();
+	auto &keys = args.data[0];
+	UnifiedVectorFormat kdata;
+	keys.ToUnifiedFormat(count, kdata);
+
+	SelectionVector sel(count);
+	for (idx_t i = 0; i < count; i++) {
+		sel.set_index(i, i);
+	}
+	idx_t approved_tuple_count = count;
+	info.filter.Filter(keys, kdata, sel, approved_tuple_count);
+
+	// rows that might be in the filter are true, NULL stays NULL, and all other rows are false
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<bool>(result);
+	memset(result_data, 0, count * sizeof(bool));
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		result_data[sel.get_index(i)] = true;
+	}
+	if (!kdata.validity.AllValid()) {
+		auto &result_validity = FlatVector::Validity(result);
+		for (idx_t i = 0; i < count; i++) {
+			if (!kdata.validity.RowIsValid(kdata.sel->get_index(i))) {
+				result_validity.SetInvalid(i);
+			}
+		}
+	}
+}
+
+unique_ptr<Expression> BloomTableFilter::ToExpression(const Expression &column) const {
+	// a membership check of the column against the Bloom filter
+	ScalarFunction lookup("bloom_filter_lookup", {column.return_type}, LogicalType::BOOLEAN, BloomFilterLookupFunction);
+	vector<unique_ptr<Expression>> children;
+	children.push_back(column.Copy());
+	return make_uniq<BoundFunctionExpression>(LogicalType::BOOLEAN, std::move(lookup), std::move(children),
+	                                          make_uniq<BloomFilterLookupData>(*this));
+}
+
+void BloomTableFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty(200, "filter", *filter);
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Deserialize(Deserializer &deserializer) {
+	auto filter = deserializer.ReadProperty<unique_ptr<BloomFilter>>(200, "filter");
+	return make_uniq<BloomTableFilter>(shared_ptr<BloomFilter>(std::move(filter)));
+}
+
+} // namespace duckdb
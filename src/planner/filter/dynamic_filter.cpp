@@ -0,0 +1,115 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/value_operations/value_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type, const LogicalType &type)
+    : filter(comparison_type, Value(type)) {
+}
+
+void DynamicFilterData::Tighten(const Value &value) {
+	D_ASSERT(!value.IsNull());
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		bool is_tighter;
+		switch (filter.comparison_type) {
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			is_tighter = ValueOperations::GreaterThan(value, filter.constant);
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			is_tighter = ValueOperations::LessThan(value, filter.constant);
+			break;
+		default:
+			throw InternalException("Unsupported comparison type for dynamic filter");
+		}
+		if (!is_tighter) {
+			return;
+		}
+	}
+	filter.constant = value;
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	initialized = false;
+}
+
+unique_ptr<ConstantFilter> DynamicFilterData::GetFilter() const {
+	lock_guard<mutex> guard(lock);
+	if (!initialized) {
+		return nullptr;
+	}
+	return make_uniq<ConstantFilter>(filter.comparison_type, filter.constant);
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+unique_ptr<ConstantFilter> DynamicFilter::GetFilter() const {
+	if (!filter_data) {
+		return nullptr;
+	}
+	return filter_data->GetFilter();
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		// the filter value can still tighten - do not let the scan drop the filter
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (!filter_data) {
+		return "true";
+	}
+	return column_name + ExpressionTypeToOperator(filter_data->filter.comparison_type) + "DYNAMIC_FILTER";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	auto filter = GetFilter();
+	if (!filter) {
+		return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+	}
+	return filter->ToExpression(column);
+}
+
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	// the filter value is only meaningful during execution - a deserialized filter passes all rows
+	TableFilter::Serialize(serializer);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(Deserializer &deserializer) {
+	return make_uniq<DynamicFilter>();
+}
+
+} // namespace duckdb
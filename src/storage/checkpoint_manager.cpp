@@ -24,7 +24,6 @@
 #include "duckdb/planner/bound_tableref.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/block_manager.hpp"
-#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -543,14 +542,10 @@ void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserialize
 		}
 	}
 
-	// FIXME: icky downcast to get the underlying MetadataReader
-	auto &binary_deserializer = dynamic_cast<BinaryDeserializer &>(deserializer);
-	auto &reader = dynamic_cast<MetadataReader &>(binary_deserializer.GetStream());
-
-	MetadataReader table_data_reader(reader.GetMetadataManager(), table_pointer);
-	TableDataReader data_reader(table_data_reader, bound_info);
-	data_reader.ReadTableData();
-
+	// the table statistics and row group pointers are only read on first access of the table (see
+	// RowGroupCollection::LoadTableData), so attaching a database with many tables only reads their catalog entries
+	bound_info.data = make_uniq<PersistentTableData>(bound_info.Base().columns.LogicalColumnCount());
+	bound_info.data->table_pointer = table_pointer;
 	bound_info.data->total_rows = total_rows;
 }
 
@@ -0,0 +1,612 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+// A PFOR_DELTA segment stores its values in groups of PFOR_DELTA_GROUP_SIZE values. Every group is encoded with the
+// cheapest of three modes:
+// - FOR: the values minus the minimum value (frame of reference) are bitpacked
+// - DELTA: the differences between consecutive values minus the minimum difference are bitpacked
+// - DELTA_OF_DELTA: the differences between consecutive differences minus their minimum are bitpacked
+// Sorted keys and timestamps with a (close to) fixed interval end up with very narrow or even zero-width groups.
+// The data of the groups grows forward from the segment header, while the offsets of the groups grow backwards from
+// the end of the block. Every group can be decoded on its own, so skipping rows never decodes the groups in between.
+// Arithmetic is done on the unsigned type, so overflowing differences wrap around and are still decoded exactly.
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = 2048;
+static constexpr const idx_t PFOR_DELTA_HEADER_SIZE = sizeof(uint64_t);
+
+typedef uint32_t pfor_delta_metadata_t;
+
+enum class PForDeltaMode : uint8_t { FOR = 1, DELTA = 2, DELTA_OF_DELTA = 3 };
+
+template <class T>
+struct PForDeltaGroup {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+
+	//! The mode (lower 8 bits) and bit width (upper bits), followed by the frame, seed value and seed delta
+	static constexpr const idx_t GROUP_HEADER_SIZE = sizeof(uint32_t) + 3 * sizeof(T);
+
+	T values[PFOR_DELTA_GROUP_SIZE];
+	bool validity[PFOR_DELTA_GROUP_SIZE];
+	T_U residuals[PFOR_DELTA_GROUP_SIZE];
+	idx_t count = 0;
+
+	bool all_invalid = true;
+	T minimum = NumericLimits<T>::Maximum();
+	T maximum = NumericLimits<T>::Minimum();
+
+	PForDeltaMode mode = PForDeltaMode::FOR;
+	bitpacking_width_t width = 0;
+	T_U frame = 0;
+	T_U seed_value = 0;
+	T_U seed_delta = 0;
+
+public:
+	void Append(T value, bool is_valid) {
+		values[count] = value;
+		validity[count] = is_valid;
+		count++;
+		if (is_valid) {
+			all_invalid = false;
+			minimum = MinValue(minimum, value);
+			maximum = MaxValue(maximum, value);
+		}
+	}
+
+	void Reset() {
+		count = 0;
+		all_invalid = true;
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+	}
+
+	//! The size of the encoded group, excluding its metadata
+	idx_t GetDataSize() const {
+		return GROUP_HEADER_SIZE + BitpackingPrimitives::GetRequiredSize(count, width);
+	}
+
+	//! Chooses the mode of the group and computes the residuals that are bitpacked
+	void Encode() {
+		D_ASSERT(count > 0);
+		auto data = reinterpret_cast<T_U *>(values);
+		FillNullValues(data);
+
+		// find the range of the values, the differences and the differences of the differences in a single pass
+		T for_min = values[0];
+		T for_max = values[0];
+		T_S delta_min = 0;
+		T_S delta_max = 0;
+		T_S dod_min = 0;
+		T_S dod_max = 0;
+		for (idx_t i = 1; i < count; i++) {
+			for_min = MinValue(for_min, values[i]);
+			for_max = MaxValue(for_max, values[i]);
+			auto delta = static_cast<T_S>(data[i] - data[i - 1]);
+			if (i == 1) {
+				delta_min = delta;
+				delta_max = delta;
+				continue;
+			}
+			delta_min = MinValue(delta_min, delta);
+			delta_max = MaxValue(delta_max, delta);
+			auto dod = static_cast<T_S>(data[i] - 2 * data[i - 1] + data[i - 2]);
+			if (i == 2) {
+				dod_min = dod;
+				dod_max = dod;
+				continue;
+			}
+			dod_min = MinValue(dod_min, dod);
+			dod_max = MaxValue(dod_max, dod);
+		}
+		auto for_width = GetWidth(static_cast<T_U>(for_max), static_cast<T_U>(for_min));
+		auto delta_width = GetWidth(static_cast<T_U>(delta_max), static_cast<T_U>(delta_min));
+		auto dod_width = GetWidth(static_cast<T_U>(dod_max), static_cast<T_U>(dod_min));
+
+		// prefer the cheaper decoding when the widths are equal
+		if (for_width <= delta_width && for_width <= dod_width) {
+			mode = PForDeltaMode::FOR;
+			width = for_width;
+			frame = static_cast<T_U>(for_min);
+			for (idx_t i = 0; i < count; i++) {
+				residuals[i] = data[i] - frame;
+			}
+		} else if (delta_width <= dod_width) {
+			mode = PForDeltaMode::DELTA;
+			width = delta_width;
+			frame = static_cast<T_U>(delta_min);
+			// the seed is chosen so that the first value has a zero residual
+			seed_value = data[0] - frame;
+			residuals[0] = 0;
+			for (idx_t i = 1; i < count; i++) {
+				residuals[i] = data[i] - data[i - 1] - frame;
+			}
+		} else {
+			mode = PForDeltaMode::DELTA_OF_DELTA;
+			width = dod_width;
+			frame = static_cast<T_U>(dod_min);
+			// the seeds are chosen so that the first two values have zero residuals
+			T_U first_delta = data[1] - data[0] - frame;
+			seed_value = data[0] - first_delta;
+			seed_delta = first_delta - frame;
+			residuals[0] = 0;
+			residuals[1] = 0;
+			for (idx_t i = 2; i < count; i++) {
+				residuals[i] = data[i] - 2 * data[i - 1] + data[i - 2] - frame;
+			}
+		}
+	}
+
+private:
+	static bitpacking_width_t GetWidth(T_U maximum, T_U minimum) {
+		return BitpackingPrimitives::MinimumBitWidth<T_U, false>(static_cast<T_U>(maximum - minimum));
+	}
+
+	//! NULL rows are never read, so they get the value that continues the sequence of the previous values
+	void FillNullValues(T_U *data) {
+		if (all_invalid) {
+			for (idx_t i = 0; i < count; i++) {
+				data[i] = 0;
+			}
+			return;
+		}
+		idx_t first_valid = 0;
+		while (!validity[first_valid]) {
+			first_valid++;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			if (validity[i]) {
+				continue;
+			}
+			if (i == 0) {
+				data[i] = data[first_valid];
+			} else if (i == 1) {
+				data[i] = data[0];
+			} else {
+				data[i] = 2 * data[i - 1] - data[i - 2];
+			}
+		}
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	explicit PForDeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	PForDeltaGroup<T> group;
+	idx_t total_size = 0;
+
+public:
+	void FlushGroup() {
+		group.Encode();
+		total_size += group.GetDataSize() + sizeof(pfor_delta_metadata_t);
+		group.Reset();
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<PForDeltaAnalyzeState<T>>(info);
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+
+	// a group must always fit in a single block, we are conservative here by multiplying by 2
+	if (sizeof(T) * PFOR_DELTA_GROUP_SIZE * 2 > state.info.GetBlockSize()) {
+		return false;
+	}
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.group.Append(data[idx], vdata.validity.RowIsValid(idx));
+		if (analyze_state.group.count == PFOR_DELTA_GROUP_SIZE) {
+			analyze_state.FlushGroup();
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	if (analyze_state.group.count > 0) {
+		analyze_state.FlushGroup();
+	}
+	return analyze_state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T, bool WRITE_STATISTICS>
+struct PForDeltaCompressState : public CompressionState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	PForDeltaCompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The next free byte for the group data
+	data_ptr_t data_ptr;
+	//! The offset of the last written group, the offsets grow backwards from the end of the block
+	data_ptr_t metadata_ptr;
+
+	PForDeltaGroup<T> group;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + PFOR_DELTA_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	bool CanStore(idx_t data_bytes, idx_t meta_bytes) {
+		auto required_data_bytes = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr + data_bytes - handle.Ptr()));
+		auto required_meta_bytes = NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) + meta_bytes;
+		return required_data_bytes + required_meta_bytes <= info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			group.Append(data[idx], vdata.validity.RowIsValid(idx));
+			if (group.count == PFOR_DELTA_GROUP_SIZE) {
+				WriteGroup();
+			}
+		}
+	}
+
+	void WriteGroup() {
+		group.Encode();
+		auto data_size = group.GetDataSize();
+		if (!CanStore(data_size, sizeof(pfor_delta_metadata_t))) {
+			// groups never span segments: the group of a row can be computed from its offset within the segment
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(data_size, sizeof(pfor_delta_metadata_t)));
+
+		metadata_ptr -= sizeof(pfor_delta_metadata_t);
+		Store<pfor_delta_metadata_t>(NumericCast<pfor_delta_metadata_t>(data_ptr - handle.Ptr()), metadata_ptr);
+
+		Store<uint32_t>(static_cast<uint32_t>(group.mode) | (static_cast<uint32_t>(group.width) << 8), data_ptr);
+		Store<T_U>(group.frame, data_ptr + sizeof(uint32_t));
+		Store<T_U>(group.seed_value, data_ptr + sizeof(uint32_t) + sizeof(T));
+		Store<T_U>(group.seed_delta, data_ptr + sizeof(uint32_t) + 2 * sizeof(T));
+		data_ptr += PForDeltaGroup<T>::GROUP_HEADER_SIZE;
+		if (group.width > 0) {
+			BitpackingPrimitives::PackBuffer<T_U, false>(data_ptr, group.residuals, group.count, group.width);
+			data_ptr += BitpackingPrimitives::GetRequiredSize(group.count, group.width);
+		}
+
+		current_segment->count += group.count;
+		if (WRITE_STATISTICS && !group.all_invalid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, group.minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, group.maximum);
+		}
+		group.Reset();
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		idx_t unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		idx_t metadata_offset = AlignValue(unaligned_offset);
+		idx_t metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		idx_t total_segment_size = metadata_offset + metadata_size;
+
+		if (unaligned_offset != metadata_offset) {
+			// zero initialize any padding bits
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// store the offset of the metadata of the first group (which is at the highest address)
+		Store<uint64_t>(metadata_offset + metadata_size, base_ptr);
+		handle.Destroy();
+
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		if (group.count > 0) {
+			WriteGroup();
+		}
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T, bool WRITE_STATISTICS>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T, WRITE_STATISTICS>>(checkpointer, state->info);
+}
+
+template <class T, bool WRITE_STATISTICS>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T, WRITE_STATISTICS>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T, bool WRITE_STATISTICS>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T, WRITE_STATISTICS>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	explicit PForDeltaScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+		// the first group is loaded lazily, so an empty segment never reads any metadata
+		auto metadata_end = Load<uint64_t>(base_ptr);
+		D_ASSERT(metadata_end <= segment.GetBlockManager().GetBlockSize());
+		metadata_ptr = base_ptr + metadata_end - sizeof(pfor_delta_metadata_t);
+		current_group_offset = PFOR_DELTA_GROUP_SIZE;
+	}
+
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	//! The metadata of the next group
+	data_ptr_t metadata_ptr;
+
+	data_ptr_t current_group_ptr = nullptr;
+	idx_t current_group_offset;
+	PForDeltaMode current_mode = PForDeltaMode::FOR;
+	bitpacking_width_t current_width = 0;
+	T_U current_frame = 0;
+	T_U current_value = 0;
+	T_U current_delta = 0;
+
+	T_U decompression_buffer[BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+
+public:
+	void LoadNextGroup() {
+		auto group_offset = Load<pfor_delta_metadata_t>(metadata_ptr);
+		metadata_ptr -= sizeof(pfor_delta_metadata_t);
+
+		auto group_ptr = base_ptr + group_offset;
+		auto mode_and_width = Load<uint32_t>(group_ptr);
+		current_mode = static_cast<PForDeltaMode>(mode_and_width & 0xFF);
+		current_width = static_cast<bitpacking_width_t>(mode_and_width >> 8);
+		current_frame = Load<T_U>(group_ptr + sizeof(uint32_t));
+		current_value = Load<T_U>(group_ptr + sizeof(uint32_t) + sizeof(T));
+		current_delta = Load<T_U>(group_ptr + sizeof(uint32_t) + 2 * sizeof(T));
+		current_group_ptr = group_ptr + PForDeltaGroup<T>::GROUP_HEADER_SIZE;
+		current_group_offset = 0;
+	}
+
+	//! Decodes the next "count" values of the current group, and writes them to "target" (if set)
+	void Decode(T *target, idx_t count) {
+		D_ASSERT(current_group_offset + count <= PFOR_DELTA_GROUP_SIZE);
+		if (!target && current_mode == PForDeltaMode::FOR) {
+			// skipping within a FOR group does not depend on the skipped values
+			current_group_offset += count;
+			return;
+		}
+		static constexpr idx_t BLOCK_SIZE = BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		idx_t decoded = 0;
+		while (decoded < count) {
+			idx_t offset_in_block = current_group_offset % BLOCK_SIZE;
+			idx_t to_decode = MinValue<idx_t>(count - decoded, BLOCK_SIZE - offset_in_block);
+			if (current_width == 0) {
+				memset(decompression_buffer, 0, sizeof(decompression_buffer));
+			} else {
+				auto block_ptr = current_group_ptr + (current_group_offset - offset_in_block) * current_width / 8;
+				BitpackingPrimitives::UnPackBlock<T_U>(data_ptr_cast(decompression_buffer), block_ptr, current_width,
+				                                       true);
+			}
+
+			auto values = decompression_buffer + offset_in_block;
+			switch (current_mode) {
+			case PForDeltaMode::FOR:
+				for (idx_t i = 0; i < to_decode; i++) {
+					values[i] += current_frame;
+				}
+				break;
+			case PForDeltaMode::DELTA:
+				for (idx_t i = 0; i < to_decode; i++) {
+					current_value += current_frame + values[i];
+					values[i] = current_value;
+				}
+				break;
+			case PForDeltaMode::DELTA_OF_DELTA:
+				for (idx_t i = 0; i < to_decode; i++) {
+					current_delta += current_frame + values[i];
+					current_value += current_delta;
+					values[i] = current_value;
+				}
+				break;
+			default:
+				throw InternalException("Invalid PFOR_DELTA mode");
+			}
+			if (target) {
+				memcpy(target + decoded, values, to_decode * sizeof(T));
+			}
+			decoded += to_decode;
+			current_group_offset += to_decode;
+		}
+	}
+
+	void Skip(idx_t skip_count) {
+		idx_t target_offset = current_group_offset + skip_count;
+		if (target_offset > PFOR_DELTA_GROUP_SIZE) {
+			// jump straight to the group that contains the target row, the groups in between are never decoded
+			idx_t groups_to_skip = (target_offset - 1) / PFOR_DELTA_GROUP_SIZE;
+			metadata_ptr -= (groups_to_skip - 1) * sizeof(pfor_delta_metadata_t);
+			LoadNextGroup();
+			target_offset -= groups_to_skip * PFOR_DELTA_GROUP_SIZE;
+		}
+		if (target_offset == PFOR_DELTA_GROUP_SIZE) {
+			// the remainder of the group is skipped: the next scan loads the next group
+			current_group_offset = PFOR_DELTA_GROUP_SIZE;
+			return;
+		}
+		Decode(nullptr, target_offset - current_group_offset);
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	auto result = make_uniq<PForDeltaScanState<T>>(segment);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		if (scan_state.current_group_offset == PFOR_DELTA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		idx_t to_scan = MinValue<idx_t>(scan_count - scanned, PFOR_DELTA_GROUP_SIZE - scan_state.current_group_offset);
+		scan_state.Decode(result_data + result_offset + scanned, to_scan);
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+template <class T>
+void PForDeltaSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	scan_state.Skip(skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	PForDeltaScanState<T> scan_state(segment);
+	scan_state.Skip(NumericCast<idx_t>(row_id));
+	if (scan_state.current_group_offset == PFOR_DELTA_GROUP_SIZE) {
+		scan_state.LoadNextGroup();
+	}
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.Decode(result_data + result_idx, 1);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T, bool WRITE_STATISTICS = true>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>,
+	                           PForDeltaInitCompression<T, WRITE_STATISTICS>, PForDeltaCompress<T, WRITE_STATISTICS>,
+	                           PForDeltaFinalizeCompress<T, WRITE_STATISTICS>, PForDeltaInitScan<T>, PForDeltaScan<T>,
+	                           PForDeltaScanPartial<T>, PForDeltaFetchRow<T>, PForDeltaSkip<T>);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetPForDeltaFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetPForDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetPForDeltaFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetPForDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	case PhysicalType::LIST:
+		return GetPForDeltaFunction<uint64_t, false>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR_DELTA");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(const PhysicalType physical_type) {
+	switch (physical_type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::LIST:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
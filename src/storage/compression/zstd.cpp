@@ -0,0 +1,514 @@
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+// A ZSTD segment stores its strings in pages of at most STANDARD_VECTOR_SIZE rows. Every page holds the lengths of
+// its strings followed by the string data, compressed as a single ZSTD frame (or stored as-is if that is smaller).
+// The pages grow forward from the segment header, while the page directory (offset and row count of every page) grows
+// backwards from the end of the block. A scan only decompresses the pages it actually reads, skipped pages are never
+// inflated.
+// Older versions cannot read these segments, so ZSTD is only used with serialization version 4, i.e., with
+// storage_compatibility_version='latest' (see ColumnDataCheckpointer). It is not used with the default settings.
+struct ZSTDStorage {
+	static constexpr const idx_t HEADER_SIZE = sizeof(uint64_t);
+	//! The uncompressed and compressed size of the page
+	static constexpr const idx_t PAGE_HEADER_SIZE = 2 * sizeof(uint32_t);
+	//! The offset and row count of the page
+	static constexpr const idx_t PAGE_ENTRY_SIZE = 2 * sizeof(uint32_t);
+	static constexpr const int COMPRESSION_LEVEL = ZSTD_CLEVEL_DEFAULT;
+	static constexpr const double MINIMUM_COMPRESSION_RATIO = 1.2;
+	//! Only every ANALYSIS_SAMPLE_INTERVAL-th vector is compressed during analysis
+	static constexpr const idx_t ANALYSIS_SAMPLE_INTERVAL = 4;
+
+	//! The uncompressed size after which a page is flushed, a single string may not exceed this either
+	static idx_t GetPageLimit(idx_t block_size) {
+		return block_size / 4;
+	}
+};
+
+struct ZSTDPageBuffer {
+	explicit ZSTDPageBuffer(idx_t block_size) : page_limit(ZSTDStorage::GetPageLimit(block_size)) {
+		lengths.reserve(STANDARD_VECTOR_SIZE);
+		validity.reserve(STANDARD_VECTOR_SIZE);
+	}
+
+	idx_t page_limit;
+	vector<uint32_t> lengths;
+	vector<bool> validity;
+	string data;
+
+public:
+	idx_t Count() const {
+		return lengths.size();
+	}
+
+	//! The size of the page before compression
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + data.size();
+	}
+
+	bool IsFull(idx_t string_size) const {
+		if (lengths.empty()) {
+			return false;
+		}
+		return lengths.size() == STANDARD_VECTOR_SIZE ||
+		       UncompressedSize() + sizeof(uint32_t) + string_size > page_limit;
+	}
+
+	void Append(const string_t &str, bool is_valid) {
+		auto size = is_valid ? str.GetSize() : 0;
+		lengths.push_back(NumericCast<uint32_t>(size));
+		validity.push_back(is_valid);
+		data.append(str.GetData(), size);
+	}
+
+	void Reset() {
+		lengths.clear();
+		validity.clear();
+		data.clear();
+	}
+
+	//! Compresses the page into "target", which must hold at least ZSTD_compressBound(UncompressedSize()) bytes
+	//! Returns the size of the compressed page, which equals the uncompressed size if compression did not pay off
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, data_ptr_t target, idx_t capacity,
+	               unsafe_unique_array<data_t> &scratch, idx_t &scratch_size) {
+		auto uncompressed_size = UncompressedSize();
+		if (scratch_size < uncompressed_size) {
+			scratch_size = NextPowerOfTwo(uncompressed_size);
+			scratch = make_unsafe_uniq_array_uninitialized<data_t>(scratch_size);
+		}
+		memcpy(scratch.get(), lengths.data(), lengths.size() * sizeof(uint32_t));
+		memcpy(scratch.get() + lengths.size() * sizeof(uint32_t), data.data(), data.size());
+
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, target, capacity, scratch.get(),
+		                                                      uncompressed_size, ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		if (compressed_size >= uncompressed_size) {
+			memcpy(target, scratch.get(), uncompressed_size);
+			return uncompressed_size;
+		}
+		return compressed_size;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info)
+	    : AnalyzeState(info), page(info.GetBlockSize()), context(duckdb_zstd::ZSTD_createCCtx()) {
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	ZSTDPageBuffer page;
+	duckdb_zstd::ZSTD_CCtx *context;
+	unsafe_unique_array<data_t> scratch;
+	idx_t scratch_size = 0;
+	unsafe_unique_array<data_t> target;
+	idx_t target_size = 0;
+
+	idx_t vector_count = 0;
+	//! The uncompressed size of all rows, and the number of pages they need
+	idx_t total_size = 0;
+	idx_t total_pages = 0;
+	//! The uncompressed and compressed size of the sampled rows
+	idx_t sampled_size = 0;
+	idx_t sampled_compressed_size = 0;
+
+public:
+	void FlushPage() {
+		auto bound = duckdb_zstd::ZSTD_compressBound(page.UncompressedSize());
+		if (target_size < bound) {
+			target_size = NextPowerOfTwo(bound);
+			target = make_unsafe_uniq_array_uninitialized<data_t>(target_size);
+		}
+		sampled_size += page.UncompressedSize();
+		sampled_compressed_size += page.Compress(context, target.get(), target_size, scratch, scratch_size);
+		page.Reset();
+	}
+};
+
+unique_ptr<AnalyzeState> ZSTDInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	bool sample_selected = state.vector_count++ % ZSTDStorage::ANALYSIS_SAMPLE_INTERVAL == 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		bool is_valid = vdata.validity.RowIsValid(idx);
+		auto string_size = is_valid ? data[idx].GetSize() : 0;
+		// we need to check all strings for this, every string has to fit in a single page
+		if (string_size >= state.page.page_limit) {
+			return false;
+		}
+		state.total_size += sizeof(uint32_t) + string_size;
+		if (!sample_selected) {
+			continue;
+		}
+		if (state.page.IsFull(string_size)) {
+			state.FlushPage();
+		}
+		state.page.Append(data[idx], is_valid);
+	}
+	if (sample_selected && state.page.Count() > 0) {
+		// pages are sampled per vector, so they are never combined with rows of a vector that was not sampled
+		state.FlushPage();
+	}
+	state.total_pages += (count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	return true;
+}
+
+idx_t ZSTDFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sampled_size == 0) {
+		// no rows were analyzed
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = double(state.sampled_compressed_size) / double(state.sampled_size);
+	auto estimated_size = double(state.total_size) * compression_ratio +
+	                      double(state.total_pages * (ZSTDStorage::PAGE_HEADER_SIZE + ZSTDStorage::PAGE_ENTRY_SIZE));
+	return NumericCast<idx_t>(estimated_size * ZSTDStorage::MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+struct ZSTDCompressState : public CompressionState {
+	ZSTDCompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)), page(info.GetBlockSize()),
+	      context(duckdb_zstd::ZSTD_createCCtx()) {
+		// a page exceeds the page limit by at most the length of a single string, so it always fits in an empty block
+		target_size = duckdb_zstd::ZSTD_compressBound(page.page_limit + sizeof(uint32_t));
+		target = make_unsafe_uniq_array_uninitialized<data_t>(target_size);
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+	~ZSTDCompressState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The next free byte for the page data
+	data_ptr_t data_ptr;
+	//! The directory entry of the last written page, the directory grows backwards from the end of the block
+	data_ptr_t metadata_ptr;
+
+	ZSTDPageBuffer page;
+	duckdb_zstd::ZSTD_CCtx *context;
+	unsafe_unique_array<data_t> scratch;
+	idx_t scratch_size = 0;
+	unsafe_unique_array<data_t> target;
+	idx_t target_size;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + ZSTDStorage::HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	bool CanStore(idx_t data_bytes, idx_t meta_bytes) {
+		auto required_data_bytes = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr + data_bytes - handle.Ptr()));
+		auto required_meta_bytes = NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) + meta_bytes;
+		return required_data_bytes + required_meta_bytes <= info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			bool is_valid = vdata.validity.RowIsValid(idx);
+			if (page.IsFull(is_valid ? data[idx].GetSize() : 0)) {
+				FlushPage();
+			}
+			page.Append(data[idx], is_valid);
+		}
+	}
+
+	void FlushPage() {
+		auto uncompressed_size = page.UncompressedSize();
+		auto compressed_size = page.Compress(context, target.get(), target_size, scratch, scratch_size);
+		auto page_size = ZSTDStorage::PAGE_HEADER_SIZE + compressed_size;
+		if (!CanStore(page_size, ZSTDStorage::PAGE_ENTRY_SIZE)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(page_size, ZSTDStorage::PAGE_ENTRY_SIZE));
+
+		metadata_ptr -= ZSTDStorage::PAGE_ENTRY_SIZE;
+		Store<uint32_t>(NumericCast<uint32_t>(data_ptr - handle.Ptr()), metadata_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(page.Count()), metadata_ptr + sizeof(uint32_t));
+
+		Store<uint32_t>(NumericCast<uint32_t>(uncompressed_size), data_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(compressed_size), data_ptr + sizeof(uint32_t));
+		memcpy(data_ptr + ZSTDStorage::PAGE_HEADER_SIZE, target.get(), compressed_size);
+		data_ptr += page_size;
+
+		// the statistics are only updated now, as the page might have moved to a new segment
+		idx_t string_offset = 0;
+		for (idx_t i = 0; i < page.Count(); i++) {
+			auto length = page.lengths[i];
+			if (page.validity[i]) {
+				string_t str(page.data.data() + string_offset, length);
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats, str);
+			}
+			string_offset += length;
+		}
+		current_segment->count += page.Count();
+		page.Reset();
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the page directory next to the pages
+		idx_t unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		idx_t metadata_offset = AlignValue(unaligned_offset);
+		idx_t metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		idx_t total_segment_size = metadata_offset + metadata_size;
+
+		if (unaligned_offset != metadata_offset) {
+			// zero initialize any padding bits
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// store the offset of the directory entry of the first page (which is at the highest address)
+		Store<uint64_t>(metadata_offset + metadata_size, base_ptr);
+		handle.Destroy();
+
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		if (page.Count() > 0) {
+			FlushPage();
+		}
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+unique_ptr<CompressionState> ZSTDInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                 unique_ptr<AnalyzeState> state) {
+	return make_uniq<ZSTDCompressState>(checkpointer, state->info);
+}
+
+void ZSTDCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+void ZSTDFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	explicit ZSTDScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+		auto metadata_end = Load<uint64_t>(base_ptr);
+		D_ASSERT(metadata_end <= segment.GetBlockManager().GetBlockSize());
+		metadata_ptr = base_ptr + metadata_end - ZSTDStorage::PAGE_ENTRY_SIZE;
+	}
+	~ZSTDScanState() override {
+		if (context) {
+			duckdb_zstd::ZSTD_freeDCtx(context);
+		}
+	}
+
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	//! The directory entry of the next page
+	data_ptr_t metadata_ptr;
+	duckdb_zstd::ZSTD_DCtx *context = nullptr;
+
+	data_ptr_t page_ptr = nullptr;
+	idx_t page_count = 0;
+	idx_t page_row = 0;
+
+	//! The decompressed page, only set once a row of the page is read
+	buffer_ptr<VectorBuffer> page_buffer;
+	uint32_t *page_lengths = nullptr;
+	const char *page_strings = nullptr;
+	//! The offset of the string of "page_row" within the decompressed page
+	idx_t string_offset = 0;
+
+public:
+	void LoadNextPage() {
+		page_ptr = base_ptr + Load<uint32_t>(metadata_ptr);
+		page_count = Load<uint32_t>(metadata_ptr + sizeof(uint32_t));
+		metadata_ptr -= ZSTDStorage::PAGE_ENTRY_SIZE;
+		page_row = 0;
+		page_buffer.reset();
+	}
+
+	void DecompressPage() {
+		auto uncompressed_size = Load<uint32_t>(page_ptr);
+		auto compressed_size = Load<uint32_t>(page_ptr + sizeof(uint32_t));
+		auto compressed_data = page_ptr + ZSTDStorage::PAGE_HEADER_SIZE;
+
+		page_buffer = make_buffer<VectorBuffer>(MaxValue<idx_t>(uncompressed_size, 1));
+		auto page_data = page_buffer->GetData();
+		if (compressed_size == uncompressed_size) {
+			memcpy(page_data, compressed_data, uncompressed_size);
+		} else {
+			if (!context) {
+				context = duckdb_zstd::ZSTD_createDCtx();
+			}
+			auto result =
+			    duckdb_zstd::ZSTD_decompressDCtx(context, page_data, uncompressed_size, compressed_data, compressed_size);
+			if (duckdb_zstd::ZSTD_isError(result) || result != uncompressed_size) {
+				throw IOException("Failed to decompress ZSTD page: the segment is corrupt");
+			}
+		}
+		page_lengths = reinterpret_cast<uint32_t *>(page_data);
+		page_strings = const_char_ptr_cast(page_data + page_count * sizeof(uint32_t));
+		string_offset = 0;
+		for (idx_t i = 0; i < page_row; i++) {
+			string_offset += page_lengths[i];
+		}
+	}
+
+	void Skip(idx_t skip_count) {
+		while (skip_count > 0) {
+			if (page_row == page_count) {
+				LoadNextPage();
+			}
+			auto to_skip = MinValue<idx_t>(skip_count, page_count - page_row);
+			if (page_buffer) {
+				for (idx_t i = 0; i < to_skip; i++) {
+					string_offset += page_lengths[page_row + i];
+				}
+			}
+			page_row += to_skip;
+			skip_count -= to_skip;
+		}
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDInitScan(ColumnSegment &segment) {
+	auto result = make_uniq<ZSTDScanState>(segment);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+void ZSTDScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                     idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		if (scan_state.page_row == scan_state.page_count) {
+			scan_state.LoadNextPage();
+		}
+		if (!scan_state.page_buffer) {
+			scan_state.DecompressPage();
+		}
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.page_count - scan_state.page_row);
+		auto target = result_data + result_offset + scanned;
+		for (idx_t i = 0; i < to_scan; i++) {
+			auto length = scan_state.page_lengths[scan_state.page_row + i];
+			target[i] = string_t(scan_state.page_strings + scan_state.string_offset, length);
+			scan_state.string_offset += length;
+		}
+		// the strings point into the decompressed page, which is kept alive by the result vector
+		StringVector::AddBuffer(result, scan_state.page_buffer);
+		scan_state.page_row += to_scan;
+		scanned += to_scan;
+	}
+}
+
+void ZSTDScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	ZSTDScanPartial(segment, state, scan_count, result, 0);
+}
+
+void ZSTDSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	scan_state.Skip(skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	ZSTDScanState scan_state(segment);
+	scan_state.Skip(NumericCast<idx_t>(row_id));
+	if (scan_state.page_row == scan_state.page_count) {
+		scan_state.LoadNextPage();
+	}
+	scan_state.DecompressPage();
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto length = scan_state.page_lengths[scan_state.page_row];
+	result_data[result_idx] =
+	    StringVector::AddStringOrBlob(result, scan_state.page_strings + scan_state.string_offset, length);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(CompressionType::COMPRESSION_ZSTD, data_type, ZSTDInitAnalyze, ZSTDAnalyze,
+	                           ZSTDFinalAnalyze, ZSTDInitCompression, ZSTDCompress, ZSTDFinalizeCompress, ZSTDInitScan,
+	                           ZSTDScan, ZSTDScanPartial, ZSTDFetchRow, ZSTDSkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
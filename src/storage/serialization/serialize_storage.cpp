@@ -31,6 +31,9 @@ void DataPointer::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<CompressionType>(103, "compression_type", compression_type);
 	serializer.WriteProperty<BaseStatistics>(104, "statistics", statistics);
 	serializer.WritePropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", segment_state);
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault<vector<BaseStatistics>>(106, "vector_statistics", vector_statistics);
+	}
 }
 
 DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
@@ -46,6 +49,7 @@ DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
 	result.compression_type = compression_type;
 	deserializer.Set<CompressionType>(compression_type);
 	deserializer.ReadPropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", result.segment_state);
+	deserializer.ReadPropertyWithDefault<vector<BaseStatistics>>(106, "vector_statistics", result.vector_statistics);
 	deserializer.Unset<CompressionType>();
 	return result;
 }
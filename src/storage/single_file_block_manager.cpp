@@ -9,9 +9,11 @@
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 
 #include <algorithm>
 #include <cstring>
+#include <thread>
 
 namespace duckdb {
 
@@ -144,7 +146,7 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, const strin
     : BlockManager(BufferManager::GetBufferManager(db), options.block_alloc_size), db(db), path(path_p),
       header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
                     Storage::FILE_HEADER_SIZE - Storage::DEFAULT_BLOCK_HEADER_SIZE),
-      iteration_count(0), options(options) {
+      iteration_count(0), options(options), write_rate_limit(0), write_rate_bytes(0) {
 }
 
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
@@ -470,9 +472,48 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
+	LimitWriteRate(buffer.AllocSize());
 	ChecksumAndWrite(buffer, BLOCK_START + NumericCast<idx_t>(block_id) * GetBlockAllocSize());
 }
 
+void SingleFileBlockManager::SetWriteRateLimit(idx_t bytes_per_second, optional_ptr<StorageLock> checkpoint_lock) {
+	lock_guard<mutex> guard(write_rate_lock);
+	write_rate_limit = bytes_per_second;
+	write_rate_start = std::chrono::steady_clock::now();
+	write_rate_bytes = 0;
+	write_rate_checkpoint_lock = checkpoint_lock;
+}
+
+void SingleFileBlockManager::LimitWriteRate(idx_t bytes) {
+	if (write_rate_limit == 0) {
+		return;
+	}
+	// we sleep in small steps, so we stop limiting the write rate soon after another thread starts waiting
+	static constexpr const auto MAX_SLEEP_TIME = std::chrono::milliseconds(10);
+	std::chrono::steady_clock::time_point earliest_write;
+	optional_ptr<StorageLock> checkpoint_lock;
+	{
+		lock_guard<mutex> guard(write_rate_lock);
+		auto limit = write_rate_limit.load();
+		if (limit == 0) {
+			return;
+		}
+		// the write can start once the bytes written before it fit in the limit
+		auto elapsed = static_cast<double>(write_rate_bytes) / static_cast<double>(limit);
+		earliest_write = write_rate_start + std::chrono::microseconds(static_cast<int64_t>(elapsed * 1000000));
+		write_rate_bytes += bytes;
+		checkpoint_lock = write_rate_checkpoint_lock;
+	}
+	while (!checkpoint_lock || !checkpoint_lock->HasWaitingSharedLocks()) {
+		auto now = std::chrono::steady_clock::now();
+		if (earliest_write <= now) {
+			return;
+		}
+		std::chrono::steady_clock::duration sleep_time = earliest_write - now;
+		std::this_thread::sleep_for(sleep_time < MAX_SLEEP_TIME ? sleep_time : MAX_SLEEP_TIME);
+	}
+}
+
 void SingleFileBlockManager::Truncate() {
 	BlockManager::Truncate();
 	idx_t blocks_to_truncate = 0;
@@ -6,11 +6,13 @@ namespace duckdb {
 
 struct StorageLockInternals : enable_shared_from_this<StorageLockInternals> {
 public:
-	StorageLockInternals() : read_count(0) {
+	StorageLockInternals() : read_count(0), waiting_shared_count(0) {
 	}
 
 	mutex exclusive_lock;
 	atomic<idx_t> read_count;
+	//! The number of threads that wait for the exclusive lock to be released in order to obtain a shared lock
+	atomic<idx_t> waiting_shared_count;
 
 public:
 	unique_ptr<StorageLockKey> GetExclusiveLock() {
@@ -21,7 +23,11 @@ public:
 	}
 
 	unique_ptr<StorageLockKey> GetSharedLock() {
-		exclusive_lock.lock();
+		if (!exclusive_lock.try_lock()) {
+			waiting_shared_count++;
+			exclusive_lock.lock();
+			waiting_shared_count--;
+		}
 		read_count++;
 		exclusive_lock.unlock();
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::SHARED);
@@ -101,4 +107,8 @@ unique_ptr<StorageLockKey> StorageLock::TryUpgradeCheckpointLock(StorageLockKey
 	return internals->TryUpgradeCheckpointLock(lock);
 }
 
+bool StorageLock::HasWaitingSharedLocks() {
+	return internals->waiting_shared_count > 0;
+}
+
 } // namespace duckdb
@@ -234,12 +234,18 @@ public:
 
 	//! Revert the commit
 	void RevertCommit() override;
+	//! Mark the commit as reverted without modifying the WAL
+	void MarkReverted() override;
+	//! Write the end of the commit to the WAL
+	void WriteCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
 
 private:
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	//! The position up to which the WAL has to be synced to make the commit persistent
+	optional_idx commit_offset;
 	WriteAheadLog &wal;
 	WALCommitState state;
 };
@@ -268,16 +274,30 @@ void SingleFileStorageCommitState::RevertCommit() {
 	}
 	if (wal.GetTotalWritten() > initial_written) {
 		// remove any entries written into the WAL by truncating it
+		// this also removes the commits of other transactions that were written after this commit - the transaction
+		// manager reverts those as well
 		wal.Truncate(initial_wal_size);
 	}
 	state = WALCommitState::TRUNCATED;
 }
 
+void SingleFileStorageCommitState::MarkReverted() {
+	state = WALCommitState::TRUNCATED;
+}
+
+void SingleFileStorageCommitState::WriteCommit() {
+	if (state != WALCommitState::IN_PROGRESS || commit_offset.IsValid()) {
+		return;
+	}
+	commit_offset = wal.WriteCommit();
+}
+
 void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	WriteCommit();
+	wal.SyncCommit(commit_offset.GetIndex());
 	state = WALCommitState::FLUSHED;
 }
 
@@ -300,9 +320,12 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 	if (GetWALSize() > 0 || config.options.force_checkpoint || options.action == CheckpointAction::FORCE_CHECKPOINT) {
 		// we only need to checkpoint if there is anything in the WAL
 		try {
+			block_manager->SetWriteRateLimit(options.max_write_rate, options.checkpoint_lock);
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
+			block_manager->SetWriteRateLimit(0);
 		} catch (std::exception &ex) {
+			block_manager->SetWriteRateLimit(0);
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
 		}
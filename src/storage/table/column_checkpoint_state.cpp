@@ -188,6 +188,15 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	if (segment->function.get().serialize_state) {
 		data_pointer.segment_state = segment->function.get().serialize_state(*segment);
 	}
+	// attach the statistics of the vectors that overlap with the segment
+	idx_t first_vector = (data_pointer.row_start - row_group.start) / STANDARD_VECTOR_SIZE;
+	idx_t last_vector = (data_pointer.row_start + tuple_count - 1 - row_group.start) / STANDARD_VECTOR_SIZE;
+	if (last_vector < vector_statistics.size()) {
+		for (idx_t vector_idx = first_vector; vector_idx <= last_vector; vector_idx++) {
+			segment->stats.vector_statistics.push_back(vector_statistics[vector_idx].Copy());
+			data_pointer.vector_statistics.push_back(vector_statistics[vector_idx].Copy());
+		}
+	}
 
 	// append the segment to the new segment tree
 	new_tree.AppendSegment(std::move(segment));
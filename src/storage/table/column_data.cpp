@@ -1,7 +1,10 @@
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/common/bloom_filter.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -79,6 +82,7 @@ void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.has_updates = HasUpdates();
 }
 
 void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) {
@@ -89,6 +93,7 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.has_updates = HasUpdates();
 }
 
 ScanVectorType ColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count) {
@@ -194,36 +199,57 @@ unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 
 void ColumnData::FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
                               bool allow_updates, bool scan_committed) {
-	lock_guard<mutex> update_guard(update_lock);
-	if (!updates) {
-		return;
+	// the update segment is pinned, so it cannot be freed by a concurrent ClearUpdates while we fetch from it
+	shared_ptr<UpdateSegment> update_segment;
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (!updates) {
+			return;
+		}
+		update_segment = updates;
 	}
-	if (!allow_updates && updates->HasUncommittedUpdates(vector_index)) {
+	if (!allow_updates && update_segment->HasUncommittedUpdates(vector_index)) {
 		throw TransactionException("Cannot create index with outstanding updates");
 	}
 	result.Flatten(scan_count);
 	if (scan_committed) {
-		updates->FetchCommitted(vector_index, result);
+		update_segment->FetchCommitted(vector_index, result);
 	} else {
-		updates->FetchUpdates(transaction, vector_index, result);
+		update_segment->FetchUpdates(transaction, vector_index, result);
 	}
 }
 
 void ColumnData::FetchUpdateRow(TransactionData transaction, row_t row_id, Vector &result, idx_t result_idx) {
-	lock_guard<mutex> update_guard(update_lock);
-	if (!updates) {
-		return;
+	// the update segment is pinned, so it cannot be freed by a concurrent ClearUpdates while we fetch from it
+	shared_ptr<UpdateSegment> update_segment;
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (!updates) {
+			return;
+		}
+		update_segment = updates;
 	}
-	updates->FetchRow(transaction, NumericCast<idx_t>(row_id), result, result_idx);
+	update_segment->FetchRow(transaction, NumericCast<idx_t>(row_id), result, result_idx);
 }
 
 void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                                 idx_t update_count, Vector &base_vector) {
-	lock_guard<mutex> update_guard(update_lock);
-	if (!updates) {
-		updates = make_uniq<UpdateSegment>(*this);
+	{
+		// the updated values are not in the Bloom filter
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
 	}
-	updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
+	shared_ptr<UpdateSegment> update_segment;
+	{
+		// the update lock only protects the creation of the update segment
+		// the update segment itself latches the individual vectors, so updates to different vectors run in parallel
+		lock_guard<mutex> update_guard(update_lock);
+		if (!updates) {
+			updates = make_shared_ptr<UpdateSegment>(*this);
+		}
+		update_segment = updates;
+	}
+	update_segment->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 }
 
 template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -362,12 +388,106 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+FilterPropagateResult ColumnData::CheckVectorZonemap(ColumnScanState &state, TableFilter &filter,
+                                                     idx_t vector_index) {
+	auto segment = state.current;
+	if (!segment) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	idx_t vector_start = start + vector_index * STANDARD_VECTOR_SIZE;
+	idx_t vector_end = MinValue<idx_t>(vector_start + STANDARD_VECTOR_SIZE, start + count);
+	if (vector_start >= segment->start + segment->count) {
+		// the scan has not moved on to the segment that contains the vector yet
+		segment = data.GetNextSegment(segment);
+		if (!segment) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	if (vector_start < segment->start || vector_end > segment->start + segment->count) {
+		// the vector spans multiple segments
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// the vector statistics are attached before the segment is added to the segment tree and never change after, so
+	// they can be read without holding the stats lock
+	auto &vector_statistics = segment->stats.vector_statistics;
+	idx_t first_vector = (segment->start - start) / STANDARD_VECTOR_SIZE;
+	if (vector_index - first_vector >= vector_statistics.size()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto prune_result = filter.CheckStatistics(vector_statistics[vector_index - first_vector]);
+	if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (!state.has_updates) {
+		// the column had no updates when the scan started
+		return prune_result;
+	}
+	// the statistics were gathered when the segment was written - updated rows are not covered by them
+	lock_guard<mutex> l(update_lock);
+	if (updates && updates->HasUpdates(vector_index)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return prune_result;
+}
+
+bool ColumnData::SupportsBloomFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Returns true if the Bloom filter proves that none of the values of the column can pass the filter, i.e., if the
+//! filter consists of equality comparisons with constants that are not in the Bloom filter
+static bool BloomFilterExcludes(const TableFilter &filter, const BloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.IsNull()) {
+			return false;
+		}
+		return !bloom_filter.Lookup(constant_filter.constant.Hash());
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		// "x = 'a' AND x IS NOT NULL" - one of the children has to exclude the column
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(*child_filter, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// IN-lists: "x = 'a' OR x = 'b'" - all children have to exclude the column
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludes(*child_filter, bloom_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
 	lock_guard<mutex> l(stats_lock);
-	return filter.CheckStatistics(stats->statistics);
+	auto prune_result = filter.CheckStatistics(stats->statistics);
+	if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE && bloom_filter &&
+	    BloomFilterExcludes(filter, *bloom_filter)) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return prune_result;
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -395,6 +515,11 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	{
+		// the appended values are not in the Bloom filter
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
+	}
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -567,6 +692,10 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 
 	ColumnDataCheckpointer checkpointer(*this, row_group, *checkpoint_state, checkpoint_info);
 	checkpointer.Checkpoint(std::move(nodes));
+	{
+		lock_guard<mutex> stats_guard(stats_lock);
+		bloom_filter = checkpoint_state->bloom_filter;
+	}
 
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
@@ -605,6 +734,7 @@ void ColumnData::DeserializeColumn(Deserializer &deserializer, BaseStatistics &t
 		    GetDatabase(), block_manager, data_pointer.block_pointer.block_id, data_pointer.block_pointer.offset, type,
 		    data_pointer.row_start, data_pointer.tuple_count, data_pointer.compression_type,
 		    std::move(data_pointer.statistics), std::move(data_pointer.segment_state));
+		segment->stats.vector_statistics = std::move(data_pointer.vector_statistics);
 
 		data.AppendSegment(std::move(segment));
 	}
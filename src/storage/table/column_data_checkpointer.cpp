@@ -4,6 +4,10 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/common/bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 
@@ -17,6 +21,15 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	auto functions = config.GetCompressionFunctions(GetType().InternalType());
 	for (auto &func : functions) {
+		auto compression_type = func.get().type;
+		bool requires_v4 = compression_type == CompressionType::COMPRESSION_PFOR_DELTA ||
+		                   compression_type == CompressionType::COMPRESSION_ZSTD;
+		if (requires_v4 && !config.options.serialization_compatibility.Compare(4)) {
+			// segments compressed with these methods cannot be read by older versions
+			// no released version maps to serialization version 4 yet, so these methods are opt-in: they are only used
+			// with storage_compatibility_version='latest', and never with the default compatibility version
+			continue;
+		}
 		compression_functions.push_back(&func.get());
 	}
 }
@@ -41,19 +54,32 @@ ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
-void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
+void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback,
+                                          const std::function<bool(idx_t)> &scan_vector_filter) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
+	idx_t vector_idx = 0;
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto &segment = *nodes[segment_idx].node;
 		ColumnScanState scan_state;
 		scan_state.current = &segment;
 		segment.InitializeScan(scan_state);
 
+		// skips are deferred until the next scanned vector: some methods (e.g. bitpacking) cannot skip to the very end
+		// of a segment, as they would load metadata past the last group
+		idx_t pending_skip = 0;
 		for (idx_t base_row_index = 0; base_row_index < segment.count; base_row_index += STANDARD_VECTOR_SIZE) {
 			scan_vector.Reference(intermediate);
 
 			idx_t count = MinValue<idx_t>(segment.count - base_row_index, STANDARD_VECTOR_SIZE);
 			scan_state.row_index = segment.start + base_row_index;
+			if (scan_vector_filter && !scan_vector_filter(vector_idx++)) {
+				pending_skip += count;
+				continue;
+			}
+			if (pending_skip > 0) {
+				segment.function.get().skip(segment, scan_state, pending_skip);
+				pending_skip = 0;
+			}
 
 			col_data.CheckpointScan(segment, scan_state, row_group.start, count, scan_vector);
 
@@ -96,6 +122,101 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
+idx_t ColumnDataCheckpointer::GetPreviousCompressionMethod() {
+	// the data was written by the previous checkpoint if all segments are persistent
+	auto previous_type = CompressionType::COMPRESSION_AUTO;
+	for (auto &node : nodes) {
+		auto &segment = *node.node;
+		if (segment.segment_type != ColumnSegmentType::PERSISTENT) {
+			return DConstants::INVALID_INDEX;
+		}
+		auto segment_type = segment.function.get().type;
+		if (segment_type == CompressionType::COMPRESSION_CONSTANT) {
+			// constant segments can be emitted by any compression method
+			continue;
+		}
+		if (previous_type != CompressionType::COMPRESSION_AUTO && previous_type != segment_type) {
+			return DConstants::INVALID_INDEX;
+		}
+		previous_type = segment_type;
+	}
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (compression_functions[i] && compression_functions[i]->type == previous_type) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+idx_t ColumnDataCheckpointer::DetectBestCompressionMethodSampled() {
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	auto sample_vectors = config.options.compression_analysis_sample_vectors;
+	idx_t total_count = 0;
+	for (auto &node : nodes) {
+		total_count += node.node->count;
+	}
+	auto vector_count = (total_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	if (vector_count <= sample_vectors) {
+		// the sample would contain all of the data
+		return DConstants::INVALID_INDEX;
+	}
+
+	vector<unique_ptr<AnalyzeState>> analyze_states;
+	analyze_states.reserve(compression_functions.size());
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (!compression_functions[i]) {
+			analyze_states.push_back(nullptr);
+			continue;
+		}
+		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
+	}
+
+	// analyze "sample_vectors" vectors that are spread evenly over the column
+	ScanSegments(
+	    [&](Vector &scan_vector, idx_t count) {
+		    for (idx_t i = 0; i < compression_functions.size(); i++) {
+			    if (!analyze_states[i]) {
+				    continue;
+			    }
+			    if (!compression_functions[i]->analyze(*analyze_states[i], scan_vector, count)) {
+				    analyze_states[i].reset();
+			    }
+		    }
+	    },
+	    [&](idx_t vector_idx) { return (vector_idx * sample_vectors) % vector_count < sample_vectors; });
+
+	idx_t best_idx = DConstants::INVALID_INDEX;
+	idx_t best_score = NumericLimits<idx_t>::Maximum();
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (!analyze_states[i]) {
+			continue;
+		}
+		auto score = compression_functions[i]->final_analyze(*analyze_states[i]);
+		if (score == DConstants::INVALID_INDEX) {
+			continue;
+		}
+		if (score < best_score) {
+			best_idx = i;
+			best_score = score;
+		}
+	}
+	return best_idx;
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompressionMethod(idx_t compression_idx) {
+	auto &function = *compression_functions[compression_idx];
+	auto analyze_state = function.init_analyze(col_data, col_data.type.InternalType());
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (analyze_state && !function.analyze(*analyze_state, scan_vector, count)) {
+			analyze_state.reset();
+		}
+	});
+	if (!analyze_state || function.final_analyze(*analyze_state) == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	return analyze_state;
+}
+
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
 	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
@@ -109,6 +230,23 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method == CompressionType::COMPRESSION_AUTO && config.options.compression_analysis_sample_vectors > 0) {
+		// rather than running every method over all of the data, we pick a candidate from the previous checkpoint of
+		// the column or from a sample of its vectors - only the candidate is then analyzed over all of the data
+		auto candidate_idx = GetPreviousCompressionMethod();
+		if (candidate_idx == DConstants::INVALID_INDEX) {
+			candidate_idx = DetectBestCompressionMethodSampled();
+		}
+		if (candidate_idx != DConstants::INVALID_INDEX) {
+			auto candidate_state = AnalyzeCompressionMethod(candidate_idx);
+			if (candidate_state) {
+				compression_idx = candidate_idx;
+				return candidate_state;
+			}
+			// the candidate cannot store all of the data: fall back to analyzing all other methods
+			compression_functions[candidate_idx] = nullptr;
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -198,13 +336,176 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	// the vector statistics are gathered before the data is compressed, so they are complete for every segment that
+	// is flushed while compressing
+	bool gather_vector_statistics = HasVectorStatistics();
+	bool build_bloom_filter = HasBloomFilter();
+	idx_t row_idx = nodes[0].node->start - row_group.start;
+	state.vector_statistics.clear();
+	vector<hash_t> bloom_filter_hashes;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (gather_vector_statistics) {
+			UpdateVectorStatistics(scan_vector, row_idx, count);
+		}
+		if (build_bloom_filter) {
+			GatherBloomFilterHashes(scan_vector, count, bloom_filter_hashes);
+		}
+		row_idx += count;
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
+	state.vector_statistics.clear();
+	if (build_bloom_filter) {
+		state.bloom_filter = CreateBloomFilter(bloom_filter_hashes);
+	}
 
 	nodes.clear();
 }
 
+bool ColumnDataCheckpointer::HasVectorStatistics() {
+	if (is_validity || col_data.parent) {
+		// only top-level columns are pruned per vector - the vectors of list children do not line up with the rows of
+		// the row group, and filters on struct fields are only checked against the segment statistics
+		return false;
+	}
+	switch (BaseStatistics::GetStatsType(GetType())) {
+	case StatisticsType::NUMERIC_STATS:
+	case StatisticsType::STRING_STATS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void UpdateVectorStatisticsInternal(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t offset,
+                                           idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNull();
+			continue;
+		}
+		NumericStats::Update<T>(stats, data[idx]);
+	}
+}
+
+template <>
+void UpdateVectorStatisticsInternal<string_t>(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t offset,
+                                              idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNull();
+			continue;
+		}
+		StringStats::Update(stats, data[idx]);
+	}
+}
+
+void ColumnDataCheckpointer::UpdateVectorStatistics(Vector &scan_vector, idx_t row_idx, idx_t count) {
+	auto &vector_statistics = state.vector_statistics;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	// the scanned vector does not have to be aligned with the vectors of the row group
+	idx_t offset = 0;
+	while (offset < count) {
+		idx_t vector_idx = (row_idx + offset) / STANDARD_VECTOR_SIZE;
+		idx_t vector_count =
+		    MinValue<idx_t>(count - offset, (vector_idx + 1) * STANDARD_VECTOR_SIZE - (row_idx + offset));
+		while (vector_statistics.size() <= vector_idx) {
+			vector_statistics.push_back(BaseStatistics::CreateEmpty(GetType()));
+		}
+		auto &stats = vector_statistics[vector_idx];
+		switch (GetType().InternalType()) {
+		case PhysicalType::BOOL:
+			UpdateVectorStatisticsInternal<bool>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::INT8:
+			UpdateVectorStatisticsInternal<int8_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::INT16:
+			UpdateVectorStatisticsInternal<int16_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::INT32:
+			UpdateVectorStatisticsInternal<int32_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::INT64:
+			UpdateVectorStatisticsInternal<int64_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::UINT8:
+			UpdateVectorStatisticsInternal<uint8_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::UINT16:
+			UpdateVectorStatisticsInternal<uint16_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::UINT32:
+			UpdateVectorStatisticsInternal<uint32_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::UINT64:
+			UpdateVectorStatisticsInternal<uint64_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::INT128:
+			UpdateVectorStatisticsInternal<hugeint_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::UINT128:
+			UpdateVectorStatisticsInternal<uhugeint_t>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::FLOAT:
+			UpdateVectorStatisticsInternal<float>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::DOUBLE:
+			UpdateVectorStatisticsInternal<double>(stats, vdata, offset, vector_count);
+			break;
+		case PhysicalType::VARCHAR:
+			UpdateVectorStatisticsInternal<string_t>(stats, vdata, offset, vector_count);
+			break;
+		default:
+			throw InternalException("Unsupported type for ColumnDataCheckpointer::UpdateVectorStatistics");
+		}
+		offset += vector_count;
+	}
+}
+
+bool ColumnDataCheckpointer::HasBloomFilter() {
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	return !is_validity && config.options.enable_row_group_bloom_filters && ColumnData::SupportsBloomFilter(GetType());
+}
+
+void ColumnDataCheckpointer::GatherBloomFilterHashes(Vector &scan_vector, idx_t count, vector<hash_t> &result) {
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(scan_vector, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			// NULL values never pass an equality filter
+			continue;
+		}
+		result.push_back(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+shared_ptr<BloomFilter> ColumnDataCheckpointer::CreateBloomFilter(vector<hash_t> &hashes) {
+	// size the filter for the number of distinct values in the row group
+	std::sort(hashes.begin(), hashes.end());
+	auto distinct_end = std::unique(hashes.begin(), hashes.end());
+	auto distinct_count = NumericCast<idx_t>(distinct_end - hashes.begin());
+
+	auto filter_size = BloomFilter::OptimalSize(distinct_count, BLOOM_FILTER_FALSE_POSITIVE_RATE);
+	auto result = make_shared_ptr<BloomFilter>(filter_size);
+	for (auto it = hashes.begin(); it != distinct_end; it++) {
+		result->Insert(*it);
+	}
+	return result;
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
@@ -226,6 +527,11 @@ bool ColumnDataCheckpointer::HasChanges() {
 void ColumnDataCheckpointer::WritePersistentSegments() {
 	// all segments are persistent and there are no updates
 	// we only need to write the metadata
+	{
+		// the data has not changed, so the Bloom filter (if any) can be kept as well
+		lock_guard<mutex> l(col_data.stats_lock);
+		state.bloom_filter = col_data.bloom_filter;
+	}
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		D_ASSERT(segment->segment_type == ColumnSegmentType::PERSISTENT);
@@ -240,6 +546,9 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 		if (segment->function.get().serialize_state) {
 			pointer.segment_state = segment->function.get().serialize_state(*segment);
 		}
+		for (auto &vector_stats : segment->stats.vector_statistics) {
+			pointer.vector_statistics.push_back(vector_stats.Copy());
+		}
 
 		// merge the persistent stats into the global column stats
 		state.global_stats->Merge(segment->stats.statistics);
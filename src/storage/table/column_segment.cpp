@@ -4,8 +4,10 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -377,28 +379,46 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_OR: {
 		// similar to the CONJUNCTION_AND, but we need to take care of the SelectionVectors (OR all of them)
-		idx_t count_total = 0;
-		SelectionVector result_sel(approved_tuple_count);
+		// every child only has to look at the tuples that did not pass any of the previous children
 		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
+		bool passed[STANDARD_VECTOR_SIZE];
+		memset(passed, 0, sizeof(passed));
+		SelectionVector remaining_sel;
+		remaining_sel.Initialize(sel);
+		idx_t remaining_count = approved_tuple_count;
 		for (auto &child_filter : conjunction_or.child_filters) {
+			if (remaining_count == 0) {
+				break;
+			}
 			SelectionVector temp_sel;
-			temp_sel.Initialize(sel);
-			idx_t temp_tuple_count = approved_tuple_count;
+			temp_sel.Initialize(remaining_sel);
+			idx_t temp_tuple_count = remaining_count;
 			idx_t temp_count = FilterSelection(temp_sel, vector, vdata, *child_filter, scan_count, temp_tuple_count);
-			// tuples passed, move them into the actual result vector
+			if (temp_count == 0) {
+				continue;
+			}
 			for (idx_t i = 0; i < temp_count; i++) {
-				auto new_idx = temp_sel.get_index(i);
-				bool is_new_idx = true;
-				for (idx_t res_idx = 0; res_idx < count_total; res_idx++) {
-					if (result_sel.get_index(res_idx) == new_idx) {
-						is_new_idx = false;
-						break;
-					}
-				}
-				if (is_new_idx) {
-					result_sel.set_index(count_total++, new_idx);
+				passed[temp_sel.get_index(i)] = true;
+			}
+			SelectionVector next_sel(remaining_count);
+			idx_t next_count = 0;
+			for (idx_t i = 0; i < remaining_count; i++) {
+				auto idx = remaining_sel.get_index(i);
+				if (!passed[idx]) {
+					next_sel.set_index(next_count++, idx);
 				}
 			}
+			remaining_sel.Initialize(next_sel);
+			remaining_count = next_count;
+		}
+		// tuples passed, move them into the actual result vector (preserving their order)
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t count_total = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (passed[idx]) {
+				result_sel.set_index(count_total++, idx);
+			}
 		}
 		sel.Initialize(result_sel);
 		approved_tuple_count = count_total;
@@ -504,6 +524,18 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	case TableFilterType::IS_NOT_NULL:
 		return TemplatedNullSelection<false>(vdata, sel, approved_tuple_count);
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomTableFilter>();
+		return bloom_filter.Filter(vector, vdata, sel, approved_tuple_count);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto constant_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (!constant_filter) {
+			// no filter value has been set yet - all rows pass
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *constant_filter, scan_count, approved_tuple_count);
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		// Apply the filter on the child vector
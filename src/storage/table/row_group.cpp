@@ -26,13 +26,14 @@
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0),
+      write_count(0) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
     : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), version_info(nullptr),
-      allocation_size(0) {
+      allocation_size(0), write_count(0) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
@@ -181,6 +182,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
+	state.row_group_write_count = write_count;
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	auto row_number = start + vector_offset * STANDARD_VECTOR_SIZE;
@@ -210,6 +212,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	}
 	state.row_group = this;
 	state.vector_index = 0;
+	state.row_group_write_count = write_count;
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	if (state.max_row_group_row == 0) {
@@ -403,6 +406,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -421,8 +426,15 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		auto base_column_idx = entry.table_column_index;
 		auto &filter = entry.filter;
 
-		auto prune_result = GetColumn(base_column_idx).CheckZonemap(state.column_scans[column_idx], filter);
+		auto &column = GetColumn(base_column_idx);
+		auto prune_result = column.CheckZonemap(state.column_scans[column_idx], filter);
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// the segment cannot be skipped - check if the vector we are about to scan can be skipped
+			prune_result = column.CheckVectorZonemap(state.column_scans[column_idx], filter, state.vector_index);
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				NextVector(state);
+				return false;
+			}
 			continue;
 		}
 		idx_t target_row = GetFilterScanCount(state.column_scans[column_idx], filter);
@@ -465,6 +477,17 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 		idx_t current_row = state.vector_index * STANDARD_VECTOR_SIZE;
 		auto max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.max_row_group_row - current_row);
 
+		if (state.row_group_write_count != write_count) {
+			// the row group was written to disk while we were scanning it (e.g. by the optimistic writer of an insert
+			// that reads from its own table) - this replaced the segments of its columns, so we continue in the new ones
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				if (column_ids[i] != COLUMN_IDENTIFIER_ROW_ID) {
+					GetColumn(column_ids[i]).InitializeScanWithOffset(state.column_scans[i], start + current_row);
+				}
+			}
+			state.row_group_write_count = write_count;
+		}
+
 		//! first check the zonemap if we have to scan this partition
 		if (!CheckZonemapSegments(state)) {
 			continue;
@@ -883,6 +906,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 		result.states.push_back(std::move(checkpoint_state));
 	}
 	D_ASSERT(result.states.size() == result.statistics.size());
+	write_count++;
 	return result;
 }
 
@@ -933,6 +957,9 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
+	SerializationOptions serialization_options;
+	serialization_options.serialization_compatibility =
+	    DBConfig::GetConfig(GetCollection().GetAttached().GetDatabase()).options.serialization_compatibility;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -945,7 +972,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		//
 		// Just as above, the state can refer to many other states, so this
 		// can cascade recursively into more pointer writes.
-		BinarySerializer serializer(data_writer);
+		BinarySerializer serializer(data_writer, serialization_options);
 		serializer.Begin();
 		state->WriteDataPointers(writer, serializer);
 		serializer.End();
@@ -4,6 +4,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
@@ -35,7 +36,15 @@ void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
 	reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
 }
 
+void RowGroupSegmentTree::InitializeLazy() {
+	current_row_group = 0;
+	max_row_group = 0;
+	finished_loading = false;
+}
+
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	// the row group pointers are only known after the table data has been read
+	collection.LoadTableData();
 	if (current_row_group >= max_row_group) {
 		reader.reset();
 		finished_loading = true;
@@ -55,7 +64,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), table_data_loaded(true) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -86,10 +95,41 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	D_ASSERT(this->row_start == 0);
 	auto l = row_groups->Lock();
 	this->total_rows = data.total_rows;
+	if (data.table_pointer.IsValid()) {
+		// the table statistics and row group pointers are read on first access
+		table_data_pointer = data.table_pointer;
+		table_data_loaded = false;
+		row_groups->InitializeLazy();
+		return;
+	}
 	row_groups->Initialize(data);
 	stats.Initialize(types, data);
 }
 
+void RowGroupCollection::LoadTableData() {
+	if (table_data_loaded) {
+		return;
+	}
+	lock_guard<mutex> guard(table_data_lock);
+	if (table_data_loaded) {
+		return;
+	}
+	PersistentTableData data(types.size());
+	MetadataReader reader(GetMetadataManager(), table_data_pointer);
+	TableDataReader data_reader(reader, data);
+	data_reader.ReadTableData(types);
+	if (data.row_group_count > 0) {
+		row_groups->Initialize(data);
+	}
+	stats.Initialize(types, data);
+	table_data_loaded = true;
+}
+
+TableStatistics &RowGroupCollection::GetTableStatistics() {
+	LoadTableData();
+	return stats;
+}
+
 void RowGroupCollection::InitializeEmpty() {
 	stats.InitializeEmpty(types);
 }
@@ -107,6 +147,10 @@ RowGroup *RowGroupCollection::GetRowGroup(int64_t index) {
 
 void RowGroupCollection::Verify() {
 #ifdef DEBUG
+	if (!table_data_loaded) {
+		// verifying the table would read all of its data
+		return;
+	}
 	idx_t current_total_rows = 0;
 	row_groups->Verify();
 	for (auto &row_group : row_groups->Segments()) {
@@ -346,9 +390,10 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 			current_row_group->Append(state.row_group_append_state, chunk, append_count);
 			allocation_size += current_row_group->GetAllocationSize() - previous_allocation_size;
 			// merge the stats
-			auto stats_lock = stats.GetLock();
+			auto &table_stats = GetTableStatistics();
+			auto stats_lock = table_stats.GetLock();
 			for (idx_t i = 0; i < types.size(); i++) {
-				current_row_group->MergeIntoStatistics(i, stats.GetStats(*stats_lock, i).Statistics());
+				current_row_group->MergeIntoStatistics(i, table_stats.GetStats(*stats_lock, i).Statistics());
 			}
 		}
 		remaining -= append_count;
@@ -375,9 +420,10 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 		}
 	}
 	state.current_row += row_t(total_append_count);
-	auto stats_lock = stats.GetLock();
+	auto &table_stats = GetTableStatistics();
+	auto stats_lock = table_stats.GetLock();
 	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
-		stats.GetStats(*stats_lock, col_idx).UpdateDistinctStatistics(chunk.data[col_idx], chunk.size());
+		table_stats.GetStats(*stats_lock, col_idx).UpdateDistinctStatistics(chunk.data[col_idx], chunk.size());
 	}
 	return new_row_group;
 }
@@ -453,7 +499,7 @@ void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
 		index += row_group->count;
 		row_groups->AppendSegment(std::move(row_group));
 	}
-	stats.MergeStats(data.stats);
+	GetTableStatistics().MergeStats(data.stats);
 	total_rows += data.total_rows.load();
 }
 
@@ -515,10 +561,11 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 		}
 		row_group->Update(transaction, updates, ids, start, pos - start, column_ids);
 
-		auto l = stats.GetLock();
+		auto &table_stats = GetTableStatistics();
+		auto l = table_stats.GetLock();
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto column_id = column_ids[i];
-			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
+			table_stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
 		}
 	} while (pos < updates.size());
 }
@@ -599,8 +646,9 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 	auto row_group = row_groups->GetSegment(UnsafeNumericCast<idx_t>(first_id));
 	row_group->UpdateColumn(transaction, updates, row_ids, column_path);
 
-	auto lock = stats.GetLock();
-	row_group->MergeIntoStatistics(primary_column_idx, stats.GetStats(*lock, primary_column_idx).Statistics());
+	auto &table_stats = GetTableStatistics();
+	auto lock = table_stats.GetLock();
+	row_group->MergeIntoStatistics(primary_column_idx, table_stats.GetStats(*lock, primary_column_idx).Statistics());
 }
 
 //===--------------------------------------------------------------------===//
@@ -960,7 +1008,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	DataChunk dummy_chunk;
 	Vector default_vector(new_column.GetType());
 
-	result->stats.InitializeAddColumn(stats, new_column.GetType());
+	result->stats.InitializeAddColumn(GetTableStatistics(), new_column.GetType());
 	auto lock = result->stats.GetLock();
 	auto &new_column_stats = result->stats.GetStats(*lock, new_column_idx);
 
@@ -983,7 +1031,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
-	result->stats.InitializeRemoveColumn(stats, col_idx);
+	result->stats.InitializeRemoveColumn(GetTableStatistics(), col_idx);
 
 	for (auto &current_row_group : row_groups->Segments()) {
 		auto new_row_group = current_row_group.RemoveColumn(*result, col_idx);
@@ -1001,7 +1049,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
-	result->stats.InitializeAlterType(stats, changed_idx, target_type);
+	result->stats.InitializeAlterType(GetTableStatistics(), changed_idx, target_type);
 
 	vector<LogicalType> scan_types;
 	for (idx_t i = 0; i < bound_columns.size(); i++) {
@@ -1073,17 +1121,18 @@ void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConst
 // Statistics
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::CopyStats(TableStatistics &other_stats) {
-	stats.CopyStats(other_stats);
+	GetTableStatistics().CopyStats(other_stats);
 }
 
 unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
-	return stats.CopyStats(column_id);
+	return GetTableStatistics().CopyStats(column_id);
 }
 
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
-	auto stats_lock = stats.GetLock();
-	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
+	auto &table_stats = GetTableStatistics();
+	auto stats_lock = table_stats.GetLock();
+	table_stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/standard_column_data.hpp"
+#include "duckdb/common/bloom_filter.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -173,6 +174,9 @@ public:
 		ColumnCheckpointState::WriteDataPointers(writer, serializer);
 		serializer.WriteObject(101, "validity",
 		                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
+		if (serializer.ShouldSerialize(4)) {
+			serializer.WritePropertyWithDefault(102, "bloom_filter", bloom_filter);
+		}
 	}
 };
 
@@ -207,6 +211,9 @@ void StandardColumnData::DeserializeColumn(Deserializer &deserializer, BaseStati
 	ColumnData::DeserializeColumn(deserializer, target_stats);
 	deserializer.ReadObject(
 	    101, "validity", [&](Deserializer &deserializer) { validity.DeserializeColumn(deserializer, target_stats); });
+	auto filter = deserializer.ReadPropertyWithDefault<shared_ptr<BloomFilter>>(102, "bloom_filter");
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter = std::move(filter);
 }
 
 void StandardColumnData::GetColumnSegmentInfo(duckdb::idx_t row_group_index, vector<duckdb::idx_t> col_path,
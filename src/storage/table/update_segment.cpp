@@ -22,7 +22,8 @@ static UpdateSegment::statistics_update_function_t GetStatisticsUpdateFunction(P
 static UpdateSegment::fetch_row_function_t GetFetchRowFunction(PhysicalType type);
 
 UpdateSegment::UpdateSegment(ColumnData &column_data)
-    : column_data(column_data), stats(column_data.type), heap(BufferAllocator::Get(column_data.GetDatabase())) {
+    : column_data(column_data), root(make_uniq<UpdateNode>()), has_updates(false), stats(column_data.type),
+      heap(BufferAllocator::Get(column_data.GetDatabase())) {
 	auto physical_type = column_data.type.InternalType();
 
 	this->type_size = GetTypeIdSize(physical_type);
@@ -40,6 +41,11 @@ UpdateSegment::UpdateSegment(ColumnData &column_data)
 UpdateSegment::~UpdateSegment() {
 }
 
+string_t UpdateSegment::AddStringToHeap(const string_t &str) {
+	lock_guard<mutex> heap_guard(heap_lock);
+	return heap.AddBlob(str);
+}
+
 //===--------------------------------------------------------------------===//
 // Update Info Helpers
 //===--------------------------------------------------------------------===//
@@ -159,10 +165,10 @@ static UpdateSegment::fetch_update_function_t GetFetchUpdateFunction(PhysicalTyp
 }
 
 void UpdateSegment::FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result) {
-	auto lock_handle = lock.GetSharedLock();
-	if (!root) {
+	if (!HasUpdates()) {
 		return;
 	}
+	auto lock_handle = vector_locks[vector_index].GetSharedLock();
 	if (!root->info[vector_index]) {
 		return;
 	}
@@ -226,11 +232,10 @@ static UpdateSegment::fetch_committed_function_t GetFetchCommittedFunction(Physi
 }
 
 void UpdateSegment::FetchCommitted(idx_t vector_index, Vector &result) {
-	auto lock_handle = lock.GetSharedLock();
-
-	if (!root) {
+	if (!HasUpdates()) {
 		return;
 	}
+	auto lock_handle = vector_locks[vector_index].GetSharedLock();
 	if (!root->info[vector_index]) {
 		return;
 	}
@@ -325,7 +330,7 @@ static UpdateSegment::fetch_committed_range_function_t GetFetchCommittedRangeFun
 
 void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &result) {
 	D_ASSERT(count > 0);
-	if (!root) {
+	if (!HasUpdates()) {
 		return;
 	}
 	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
@@ -337,6 +342,7 @@ void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &re
 	D_ASSERT(end_vector < Storage::ROW_GROUP_VECTOR_COUNT);
 
 	for (idx_t vector_idx = start_vector; vector_idx <= end_vector; vector_idx++) {
+		auto lock_handle = vector_locks[vector_idx].GetSharedLock();
 		if (!root->info[vector_idx]) {
 			continue;
 		}
@@ -428,10 +434,11 @@ static UpdateSegment::fetch_row_function_t GetFetchRowFunction(PhysicalType type
 }
 
 void UpdateSegment::FetchRow(TransactionData transaction, idx_t row_id, Vector &result, idx_t result_idx) {
-	if (!root) {
+	if (!HasUpdates()) {
 		return;
 	}
 	idx_t vector_index = (row_id - column_data.start) / STANDARD_VECTOR_SIZE;
+	auto lock_handle = vector_locks[vector_index].GetSharedLock();
 	if (!root->info[vector_index]) {
 		return;
 	}
@@ -497,8 +504,8 @@ static UpdateSegment::rollback_update_function_t GetRollbackUpdateFunction(Physi
 }
 
 void UpdateSegment::RollbackUpdate(UpdateInfo &info) {
-	// obtain an exclusive lock
-	auto lock_handle = lock.GetExclusiveLock();
+	// obtain an exclusive lock on the vector
+	auto lock_handle = vector_locks[info.vector_index].GetExclusiveLock();
 
 	// move the data from the UpdateInfo back into the base info
 	if (!root->info[info.vector_index]) {
@@ -523,8 +530,8 @@ void UpdateSegment::CleanupUpdateInternal(const StorageLockKey &lock, UpdateInfo
 }
 
 void UpdateSegment::CleanupUpdate(UpdateInfo &info) {
-	// obtain an exclusive lock
-	auto lock_handle = lock.GetExclusiveLock();
+	// obtain an exclusive lock on the vector
+	auto lock_handle = vector_locks[info.vector_index].GetExclusiveLock();
 	CleanupUpdateInternal(*lock_handle, info);
 }
 
@@ -623,7 +630,7 @@ struct UpdateSelectElement {
 
 template <>
 string_t UpdateSelectElement::Operation(UpdateSegment *segment, string_t element) {
-	return element.IsInlined() ? element : segment->GetStringHeap().AddBlob(element);
+	return element.IsInlined() ? element : segment->AddStringToHeap(element);
 }
 
 template <class T>
@@ -953,7 +960,7 @@ idx_t UpdateStringStatistics(UpdateSegment *segment, SegmentStatistics &stats, V
 		for (idx_t i = 0; i < count; i++) {
 			StringStats::Update(stats.statistics, update_data[i]);
 			if (!update_data[i].IsInlined()) {
-				update_data[i] = segment->GetStringHeap().AddBlob(update_data[i]);
+				update_data[i] = segment->AddStringToHeap(update_data[i]);
 			}
 		}
 		sel.Initialize(nullptr);
@@ -966,7 +973,7 @@ idx_t UpdateStringStatistics(UpdateSegment *segment, SegmentStatistics &stats, V
 				sel.set_index(not_null_count++, i);
 				StringStats::Update(stats.statistics, update_data[i]);
 				if (!update_data[i].IsInlined()) {
-					update_data[i] = segment->GetStringHeap().AddBlob(update_data[i]);
+					update_data[i] = segment->AddStringToHeap(update_data[i]);
 				}
 			}
 		}
@@ -1074,11 +1081,22 @@ UpdateInfo *CreateEmptyUpdateInfo(TransactionData transaction, idx_t type_size,
 
 void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vector &update, row_t *ids, idx_t count,
                            Vector &base_data) {
-	// obtain an exclusive lock
-	auto write_lock = lock.GetExclusiveLock();
-
+	if (count == 0) {
+		return;
+	}
 	update.Flatten(count);
 
+	// get the vector index based on the first id
+	// we assert that all updates must be part of the same vector
+	D_ASSERT(idx_t(ids[0]) >= column_data.start);
+	idx_t vector_index = (UnsafeNumericCast<idx_t>(ids[0]) - column_data.start) / STANDARD_VECTOR_SIZE;
+	idx_t vector_offset = column_data.start + vector_index * STANDARD_VECTOR_SIZE;
+	D_ASSERT(vector_index < Storage::ROW_GROUP_VECTOR_COUNT);
+
+	// obtain an exclusive lock on the vector - updates to other vectors of this segment can proceed concurrently
+	// the statistics are updated under this lock as well, together with the data
+	auto write_lock = vector_locks[vector_index].GetExclusiveLock();
+
 	// update statistics
 	SelectionVector sel;
 	{
@@ -1095,20 +1113,8 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 	// hence we explicitly check here if the ids are sorted and, if not, sort + duplicate eliminate them
 	count = SortSelectionVector(sel, count, ids);
 	D_ASSERT(count > 0);
-
-	// create the versions for this segment, if there are none yet
-	if (!root) {
-		root = make_uniq<UpdateNode>();
-	}
-
-	// get the vector index based on the first id
-	// we assert that all updates must be part of the same vector
-	auto first_id = ids[sel.get_index(0)];
-	idx_t vector_index = (UnsafeNumericCast<idx_t>(first_id) - column_data.start) / STANDARD_VECTOR_SIZE;
-	idx_t vector_offset = column_data.start + vector_index * STANDARD_VECTOR_SIZE;
-
-	D_ASSERT(idx_t(first_id) >= column_data.start);
-	D_ASSERT(vector_index < Storage::ROW_GROUP_VECTOR_COUNT);
+	D_ASSERT((UnsafeNumericCast<idx_t>(ids[sel.get_index(0)]) - column_data.start) / STANDARD_VECTOR_SIZE ==
+	         vector_index);
 
 	// first check the version chain
 	UpdateInfo *node = nullptr;
@@ -1196,26 +1202,31 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 		result->info->Verify();
 
 		root->info[vector_index] = std::move(result);
+		has_updates = true;
 	}
 }
 
 bool UpdateSegment::HasUpdates() const {
-	return root.get() != nullptr;
+	return has_updates;
 }
 
-bool UpdateSegment::HasUpdates(idx_t vector_index) const {
+bool UpdateSegment::HasUpdates(idx_t vector_index) {
 	if (!HasUpdates()) {
 		return false;
 	}
+	auto read_lock = vector_locks[vector_index].GetSharedLock();
 	return root->info[vector_index].get();
 }
 
 bool UpdateSegment::HasUncommittedUpdates(idx_t vector_index) {
-	if (!HasUpdates(vector_index)) {
+	if (!HasUpdates()) {
 		return false;
 	}
-	auto read_lock = lock.GetSharedLock();
+	auto read_lock = vector_locks[vector_index].GetSharedLock();
 	auto entry = root->info[vector_index].get();
+	if (!entry) {
+		return false;
+	}
 	if (entry->info->next) {
 		return true;
 	}
@@ -1226,10 +1237,10 @@ bool UpdateSegment::HasUpdates(idx_t start_row_index, idx_t end_row_index) {
 	if (!HasUpdates()) {
 		return false;
 	}
-	auto read_lock = lock.GetSharedLock();
 	idx_t base_vector_index = start_row_index / STANDARD_VECTOR_SIZE;
 	idx_t end_vector_index = end_row_index / STANDARD_VECTOR_SIZE;
 	for (idx_t i = base_vector_index; i <= end_vector_index; i++) {
+		auto read_lock = vector_locks[i].GetSharedLock();
 		if (root->info[i]) {
 			return true;
 		}
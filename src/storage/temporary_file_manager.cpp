@@ -1,6 +1,10 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +12,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +63,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +70,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -90,15 +94,91 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 	return index;
 }
 
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+TemporaryFileCompressionAdaptivity::TemporaryFileCompressionAdaptivity() : block_count(0) {
+	for (idx_t level_idx = 0; level_idx < LEVELS; level_idx++) {
+		average_time_ns[level_idx] = 0;
+	}
+}
+
+int64_t TemporaryFileCompressionAdaptivity::GetCurrentTimeNanos() {
+	return std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now())
+	    .time_since_epoch()
+	    .count();
+}
+
+TemporaryCompressionLevel TemporaryFileCompressionAdaptivity::GetCompressionLevel() {
+	auto count = block_count++;
+	// levels that have not been measured yet have an average of 0, so they are tried first
+	idx_t best_idx = 0;
+	for (idx_t level_idx = 1; level_idx < LEVELS; level_idx++) {
+		if (average_time_ns[level_idx].load() < average_time_ns[best_idx].load()) {
+			best_idx = level_idx;
+		}
+	}
+	if (count % EXPLORATION_INTERVAL == EXPLORATION_INTERVAL - 1) {
+		// explore one of the other levels, the data (or the disk) might have changed
+		auto offset = 1 + (count / EXPLORATION_INTERVAL) % (LEVELS - 1);
+		best_idx = (best_idx + offset) % LEVELS;
+	}
+	return IndexToLevel(best_idx);
+}
+
+void TemporaryFileCompressionAdaptivity::Update(TemporaryCompressionLevel level, int64_t time_before_ns) {
+	auto time_ns = MaxValue<int64_t>(GetCurrentTimeNanos() - time_before_ns, 1);
+	auto &average = average_time_ns[LevelToIndex(level)];
+	// this is not atomic as a whole, but losing a measurement every now and then is fine
+	auto previous_average = average.load();
+	average = previous_average == 0 ? time_ns : (previous_average * 7 + time_ns) / 8;
+}
+
+idx_t TemporaryFileCompressionAdaptivity::LevelToIndex(TemporaryCompressionLevel level) {
+	switch (level) {
+	case TemporaryCompressionLevel::UNCOMPRESSED:
+		return 0;
+	case TemporaryCompressionLevel::ZSTD_MINUS_THREE:
+		return 1;
+	case TemporaryCompressionLevel::ZSTD_ONE:
+		return 2;
+	default:
+		throw InternalException("Unknown TemporaryCompressionLevel");
+	}
+}
+
+TemporaryCompressionLevel TemporaryFileCompressionAdaptivity::IndexToLevel(idx_t index) {
+	switch (index) {
+	case 0:
+		return TemporaryCompressionLevel::UNCOMPRESSED;
+	case 1:
+		return TemporaryCompressionLevel::ZSTD_MINUS_THREE;
+	case 2:
+		return TemporaryCompressionLevel::ZSTD_ONE;
+	default:
+		throw InternalException("Unknown TemporaryCompressionLevel index");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string TemporaryFileName(DatabaseInstance &db, idx_t index, idx_t slot_size) {
+	if (slot_size == BufferManager::GetBufferManager(db).GetBlockAllocSize()) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files with smaller slots hold compressed blocks - include the slot size in the name
+	return "duckdb_temp_storage_" + to_string(slot_size) + "-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, TemporaryFileName(db, index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +197,47 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
-	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	D_ASSERT(buffer.size == buffer_manager.GetBlockSize());
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// the slot holds the size of the compressed block, followed by the compressed block
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		auto position = GetPositionInFile(block_index);
+		auto block_size = buffer_manager.GetBlockSize();
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position, block_size,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the compressed block, and decompress it into a new buffer
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size > slot_size - sizeof(idx_t)) {
+		throw IOException("Failed to read block from temporary file \"%s\": invalid compressed size", path);
+	}
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                                      compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block from temporary file \"%s\"", path);
+	}
+	return buffer;
+}
+
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +291,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -283,11 +393,25 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the buffer (if enabled), the compressed size determines the size of the slot we write it to
+	const bool compress = DBConfig::GetConfig(db).options.temp_file_compression;
+	auto compression_level = TemporaryCompressionLevel::UNCOMPRESSED;
+	int64_t time_before_ns = 0;
+	if (compress) {
+		compression_level = compression_adaptivity.GetCompressionLevel();
+		time_before_ns = TemporaryFileCompressionAdaptivity::GetCurrentTimeNanos();
+	}
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(compression_level, buffer, compressed_buffer);
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file (with slots of the right size)
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +421,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +433,40 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+	if (compress) {
+		compression_adaptivity.Update(compression_level, time_before_ns);
+	}
+}
+
+idx_t TemporaryFileManager::CompressBuffer(TemporaryCompressionLevel level, FileBuffer &buffer,
+                                           AllocatedData &compressed_buffer) {
+	// compressed blocks are written to slots of a multiple of 1/8th of the block size
+	static constexpr idx_t SLOT_SIZE_CLASSES = 8;
+	auto block_alloc_size = BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	if (level == TemporaryCompressionLevel::UNCOMPRESSED) {
+		return block_alloc_size;
+	}
+	D_ASSERT(buffer.AllocSize() == block_alloc_size);
+	auto compressed_bound = duckdb_zstd::ZSTD_compressBound(buffer.AllocSize());
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + compressed_bound);
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compress(compressed_buffer.get() + sizeof(idx_t), compressed_bound, buffer.InternalBuffer(),
+	                               buffer.AllocSize(), static_cast<int>(level));
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw IOException("Failed to compress block for temporary file: %s",
+		                  duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	Store<idx_t>(compressed_size, compressed_buffer.get());
+
+	auto slot_granularity = block_alloc_size / SLOT_SIZE_CLASSES;
+	auto slot_size = (sizeof(idx_t) + compressed_size + slot_granularity - 1) / slot_granularity * slot_granularity;
+	if (slot_size >= block_alloc_size) {
+		// the block did not compress well enough to fit in a smaller slot: write it uncompressed
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	return slot_size;
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
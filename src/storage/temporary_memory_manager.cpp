@@ -9,8 +9,8 @@
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           ClientContext &context_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
 }
 
@@ -72,7 +72,7 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	memory_limit = NumericCast<idx_t>(MAXIMUM_MEMORY_LIMIT_RATIO * static_cast<double>(buffer_manager.GetMaxMemory()));
 	has_temporary_directory = buffer_manager.HasTemporaryDirectory();
 	num_threads = NumericCast<idx_t>(task_scheduler.NumberOfThreads());
-	query_max_memory = buffer_manager.GetQueryMaxMemory();
+	query_max_memory = buffer_manager.GetQueryMaxMemory(context);
 }
 
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
@@ -85,7 +85,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -101,6 +101,9 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 	const auto lower_bound =
 	    MinValue(temporary_memory_state.GetMinimumReservation(), temporary_memory_state.GetRemainingSize());
 
+	// The reservations of the other states of the same query
+	const auto query_reservation = GetQueryReservation(context) - temporary_memory_state.GetReservation();
+
 	if (context.config.force_external) {
 		// We're forcing external processing. Give it the minimum
 		SetReservation(temporary_memory_state, lower_bound);
@@ -110,15 +113,17 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 	} else if (temporary_memory_state.GetRemainingSize() == 0) {
 		// Sometimes set to 0 to denote end of state (before actually deleting the state)
 		SetReservation(temporary_memory_state, 0);
-	} else if (reservation - temporary_memory_state.GetReservation() + lower_bound >= memory_limit) {
-		// We overshot. Set reservation equal to the minimum
+	} else if (reservation - temporary_memory_state.GetReservation() + lower_bound >= memory_limit ||
+	           query_reservation + lower_bound >= query_max_memory) {
+		// We overshot (either in total, or within the budget of this query). Set reservation equal to the minimum
 		SetReservation(temporary_memory_state, lower_bound);
 	} else {
 		// The upper bound for the reservation of this state is the minimum of:
 		// 1. Remaining size of the state
-		// 2. The max memory per query
+		// 2. The max memory per query, minus what the other states of the query have reserved
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
-		auto upper_bound = MinValue<idx_t>(temporary_memory_state.GetRemainingSize(), query_max_memory);
+		auto upper_bound =
+		    MinValue<idx_t>(temporary_memory_state.GetRemainingSize(), query_max_memory - query_reservation);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue<idx_t>(upper_bound,
 		                              NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * static_cast<double>(free_memory)));
@@ -150,8 +155,22 @@ void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_me
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.GetReservation());
 	this->reservation -= temporary_memory_state.GetReservation();
+
+	auto &query_reservation = query_reservations[temporary_memory_state.context];
+	D_ASSERT(query_reservation >= temporary_memory_state.GetReservation());
+	query_reservation -= temporary_memory_state.GetReservation();
+
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.GetReservation();
+	query_reservation += temporary_memory_state.GetReservation();
+	if (query_reservation == 0) {
+		query_reservations.erase(temporary_memory_state.context);
+	}
+}
+
+idx_t TemporaryMemoryManager::GetQueryReservation(ClientContext &context) const {
+	auto entry = query_reservations.find(context);
+	return entry == query_reservations.end() ? 0 : entry->second;
 }
 
 idx_t TemporaryMemoryManager::ComputeOptimalReservation(const TemporaryMemoryState &temporary_memory_state,
@@ -254,6 +273,11 @@ void TemporaryMemoryManager::Verify() const {
 	}
 	D_ASSERT(total_reservation == this->reservation);
 	D_ASSERT(total_remaining_size == this->remaining_size);
+	idx_t total_query_reservation = 0;
+	for (auto &query_reservation : query_reservations) {
+		total_query_reservation += query_reservation.second;
+	}
+	D_ASSERT(total_query_reservation == this->reservation);
 #endif
 }
 
@@ -10,6 +10,7 @@
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -26,15 +27,52 @@
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
 
+//! The inserted chunks of a table that are appended to the transaction-local storage together
+struct ReplayTableInserts {
+	explicit ReplayTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<unique_ptr<DataChunk>> chunks;
+	idx_t row_count = 0;
+	//! The append state, if the chunks are appended to the transaction-local storage directly
+	LocalAppendState append_state;
+	//! The collections the chunks are appended to in parallel, if there are enough rows to split them over row groups
+	//! - these are merged into the transaction-local storage in order afterwards
+	vector<unique_ptr<RowGroupCollection>> collections;
+};
+
+//! A part of the inserts into one table, that is appended by one thread
+struct ReplayInsertTask {
+	ReplayInsertTask(ReplayTableInserts &inserts, idx_t collection_idx, idx_t chunk_start, idx_t chunk_end)
+	    : inserts(inserts), collection_idx(collection_idx), chunk_start(chunk_start), chunk_end(chunk_end) {
+	}
+
+	ReplayTableInserts &inserts;
+	//! The collection to append to, or DConstants::INVALID_INDEX to append to the transaction-local storage
+	idx_t collection_idx;
+	idx_t chunk_start;
+	idx_t chunk_end;
+};
+
 class ReplayState {
+public:
+	//! The amount of inserted chunks that are deserialized before they are appended
+	static constexpr const idx_t INSERT_BATCH_SIZE = 4 * Storage::ROW_GROUP_VECTOR_COUNT;
+
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
 	}
+	~ReplayState() {
+		CancelInserts();
+	}
 
 	AttachedDatabase &db;
 	ClientContext &context;
@@ -42,8 +80,262 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+public:
+	//! Adds an inserted chunk - inserts are appended in the background while the WAL entries that follow them are
+	//! deserialized
+	void AddInsert(TableCatalogEntry &table, unique_ptr<DataChunk> chunk);
+	//! Appends all inserts that were added - called before replaying any other entry, as it might depend on them
+	void FlushInserts();
+	//! Waits for the inserts that are being appended without throwing and stops the worker threads - used when
+	//! replaying the WAL failed
+	void CancelInserts();
+	//! Stops the worker threads and waits for them to exit - used when replaying the WAL finished
+	void StopWorkers();
+
+private:
+	//! Starts appending the inserts that were added
+	void ScheduleInserts();
+	//! Waits until the inserts that are being appended are finished, and merges their collections in order
+	void WaitForInserts();
+	//! Executes the insert tasks until there are none left
+	void WorkOnTasks();
+	//! The loop of the worker threads - works on every batch of tasks that is scheduled until the workers are stopped
+	void WorkerThread();
+	void ExecuteTask(ReplayInsertTask &task);
+
+private:
+	//! The inserts that have been deserialized but not yet scheduled, per table
+	vector<unique_ptr<ReplayTableInserts>> pending_inserts;
+	idx_t pending_chunk_count = 0;
+	//! The inserts that are being appended - inserts into different tables and inserts into different row groups of
+	//! the same table are appended in parallel, but the rows of a table keep the order in which they are in the WAL
+	//! (later entries can refer to their row ids)
+	vector<unique_ptr<ReplayTableInserts>> active_inserts;
+	vector<ReplayInsertTask> tasks;
+	atomic<idx_t> next_task {0};
+	//! The threads that append the inserts - the WAL is replayed while the database is loaded, before the threads of
+	//! the task scheduler are launched, so the replay uses its own threads. These are launched for the first batch of
+	//! tasks and are reused for every batch after that
+	vector<thread> threads;
+	//! Protects the batch state below - the tasks of a batch are only accessed by the workers while the batch is open
+	mutex task_lock;
+	std::condition_variable task_signal;
+	std::condition_variable finished_signal;
+	idx_t batch_id = 0;
+	bool batch_open = false;
+	idx_t active_workers = 0;
+	bool stop_workers = false;
+	mutex error_lock;
+	ErrorData error;
+	//! We don't do any constraint verification here - the append states refer to this (empty) list of constraints
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
 };
 
+void ReplayState::AddInsert(TableCatalogEntry &table, unique_ptr<DataChunk> chunk) {
+	optional_ptr<ReplayTableInserts> table_inserts;
+	for (auto &inserts : pending_inserts) {
+		if (RefersToSameObject(inserts->table, table)) {
+			table_inserts = inserts.get();
+			break;
+		}
+	}
+	if (!table_inserts) {
+		pending_inserts.push_back(make_uniq<ReplayTableInserts>(table));
+		table_inserts = pending_inserts.back().get();
+	}
+	table_inserts->row_count += chunk->size();
+	table_inserts->chunks.push_back(std::move(chunk));
+	pending_chunk_count++;
+	if (pending_chunk_count >= INSERT_BATCH_SIZE) {
+		ScheduleInserts();
+	}
+}
+
+void ReplayState::ScheduleInserts() {
+	// the previous batch can contain inserts into the same tables - wait for it first
+	WaitForInserts();
+	if (pending_inserts.empty()) {
+		return;
+	}
+	for (auto &inserts_p : pending_inserts) {
+		active_inserts.push_back(std::move(inserts_p));
+		auto &inserts = *active_inserts.back();
+		auto &storage = inserts.table.GetStorage();
+		if (inserts.row_count < 2 * Storage::ROW_GROUP_SIZE || inserts.table.HasGeneratedColumns() ||
+		    storage.HasIndexes()) {
+			// append all chunks to the transaction-local storage with a single task
+			storage.InitializeLocalAppend(inserts.append_state, inserts.table, context, bound_constraints);
+			if (inserts.table.HasGeneratedColumns()) {
+				// verifying generated columns binds expressions using the client context - append these on this thread
+				ReplayInsertTask task(inserts, DConstants::INVALID_INDEX, 0, inserts.chunks.size());
+				ExecuteTask(task);
+				continue;
+			}
+			tasks.emplace_back(inserts, DConstants::INVALID_INDEX, 0, inserts.chunks.size());
+			continue;
+		}
+		// split the chunks over row groups that are appended in parallel - every task fills its own collection
+		auto table_info = storage.GetDataTableInfo();
+		auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+		auto types = storage.GetTypes();
+		idx_t chunk_start = 0;
+		idx_t task_rows = 0;
+		for (idx_t chunk_idx = 0; chunk_idx < inserts.chunks.size(); chunk_idx++) {
+			task_rows += inserts.chunks[chunk_idx]->size();
+			if (task_rows < Storage::ROW_GROUP_SIZE && chunk_idx + 1 < inserts.chunks.size()) {
+				continue;
+			}
+			auto collection =
+			    make_uniq<RowGroupCollection>(table_info, block_manager, types, NumericCast<idx_t>(MAX_ROW_ID));
+			collection->InitializeEmpty();
+			tasks.emplace_back(inserts, inserts.collections.size(), chunk_start, chunk_idx + 1);
+			inserts.collections.push_back(std::move(collection));
+			chunk_start = chunk_idx + 1;
+			task_rows = 0;
+		}
+	}
+	pending_inserts.clear();
+	pending_chunk_count = 0;
+
+	if (tasks.empty()) {
+		return;
+	}
+	// hand the tasks to the workers - the replaying thread continues to deserialize the WAL in the mean time
+	{
+		lock_guard<mutex> guard(task_lock);
+		next_task = 0;
+		batch_id++;
+		batch_open = true;
+	}
+	task_signal.notify_all();
+	if (threads.empty()) {
+		auto thread_count = DBConfig::GetConfig(context).options.maximum_threads - 1;
+		for (idx_t i = 0; i < thread_count; i++) {
+			threads.emplace_back([this]() { WorkerThread(); });
+		}
+	}
+}
+
+void ReplayState::WorkerThread() {
+	idx_t current_batch = 0;
+	while (true) {
+		{
+			unique_lock<mutex> guard(task_lock);
+			task_signal.wait(guard, [&]() { return stop_workers || (batch_open && batch_id != current_batch); });
+			if (stop_workers) {
+				return;
+			}
+			current_batch = batch_id;
+			active_workers++;
+		}
+		WorkOnTasks();
+		lock_guard<mutex> guard(task_lock);
+		active_workers--;
+		if (active_workers == 0) {
+			finished_signal.notify_one();
+		}
+	}
+}
+
+void ReplayState::StopWorkers() {
+	{
+		lock_guard<mutex> guard(task_lock);
+		stop_workers = true;
+	}
+	task_signal.notify_all();
+	for (auto &worker : threads) {
+		worker.join();
+	}
+	threads.clear();
+}
+
+void ReplayState::WorkOnTasks() {
+	while (true) {
+		auto task_idx = next_task++;
+		if (task_idx >= tasks.size()) {
+			return;
+		}
+		try {
+			ExecuteTask(tasks[task_idx]);
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(error_lock);
+			if (!error.HasError()) {
+				error = ErrorData(ex);
+			}
+		} catch (...) { // NOLINT
+			lock_guard<mutex> guard(error_lock);
+			if (!error.HasError()) {
+				error = ErrorData("Unknown exception while replaying WAL inserts");
+			}
+		}
+	}
+}
+
+void ReplayState::ExecuteTask(ReplayInsertTask &task) {
+	auto &inserts = task.inserts;
+	auto &storage = inserts.table.GetStorage();
+	if (task.collection_idx == DConstants::INVALID_INDEX) {
+		for (idx_t chunk_idx = task.chunk_start; chunk_idx < task.chunk_end; chunk_idx++) {
+			storage.LocalAppend(inserts.append_state, inserts.table, context, *inserts.chunks[chunk_idx]);
+			inserts.chunks[chunk_idx].reset();
+		}
+		storage.FinalizeLocalAppend(inserts.append_state);
+		return;
+	}
+	auto &collection = *inserts.collections[task.collection_idx];
+	TableAppendState append_state;
+	collection.InitializeAppend(append_state);
+	for (idx_t chunk_idx = task.chunk_start; chunk_idx < task.chunk_end; chunk_idx++) {
+		collection.Append(*inserts.chunks[chunk_idx], append_state);
+		inserts.chunks[chunk_idx].reset();
+	}
+	collection.FinalizeAppend(TransactionData(0, 0), append_state);
+}
+
+void ReplayState::WaitForInserts() {
+	if (active_inserts.empty()) {
+		return;
+	}
+	// work on the remaining tasks on this thread as well
+	WorkOnTasks();
+	{
+		// close the batch and wait for the workers that are still executing a task
+		unique_lock<mutex> guard(task_lock);
+		batch_open = false;
+		finished_signal.wait(guard, [&]() { return active_workers == 0; });
+	}
+	tasks.clear();
+	auto inserts = std::move(active_inserts);
+	if (error.HasError()) {
+		auto task_error = std::move(error);
+		error = ErrorData();
+		task_error.Throw();
+	}
+	// merge the collections that were appended in parallel into the transaction-local storage, in order
+	for (auto &table_inserts : inserts) {
+		for (auto &collection : table_inserts->collections) {
+			table_inserts->table.GetStorage().LocalMerge(context, *collection);
+		}
+	}
+}
+
+void ReplayState::FlushInserts() {
+	ScheduleInserts();
+	WaitForInserts();
+}
+
+void ReplayState::CancelInserts() {
+	try {
+		WaitForInserts();
+	} catch (...) { // NOLINT
+	}
+	active_inserts.clear();
+	pending_inserts.clear();
+	pending_chunk_count = 0;
+	StopWorkers();
+}
+
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
@@ -97,6 +389,10 @@ public:
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (!DeserializeOnly() && wal_type != WALType::INSERT_TUPLE && wal_type != WALType::USE_TABLE) {
+			// any other entry (and the commit) can depend on the inserts that precede it
+			state.FlushInserts();
+		}
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
 			return true;
@@ -224,6 +520,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
+					state.StopWorkers();
 					break;
 				}
 				con.BeginTransaction();
@@ -232,6 +529,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		// exception thrown in WAL replay: rollback
+		state.CancelInserts();
 		con.Query("ROLLBACK");
 		ErrorData error(ex);
 		// serialization failure means a truncated WAL
@@ -242,6 +540,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		}
 	} catch (...) {
 		// exception thrown in WAL replay: rollback
+		state.CancelInserts();
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
@@ -639,8 +938,8 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
-	DataChunk chunk;
-	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+	auto chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk->Deserialize(object); });
 	if (DeserializeOnly()) {
 		return;
 	}
@@ -649,9 +948,7 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 	}
 
 	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+	state.AddInsert(*state.current_table, std::move(chunk));
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
@@ -14,6 +14,8 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 
 namespace duckdb {
@@ -21,7 +23,8 @@ namespace duckdb {
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), sync_in_progress(false),
+      written_offset(0), synced_offset(0), failed_offset(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -397,14 +400,64 @@ void WriteAheadLog::Flush() {
 	if (!writer) {
 		return;
 	}
+	SyncCommit(WriteCommit());
+}
 
+idx_t WriteAheadLog::WriteCommit() {
+	if (!writer) {
+		return 0;
+	}
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// hand all changes made to the WAL to the OS, so a concurrent sync can include them
+	writer->Flush();
 	wal_size = writer->GetFileSize();
+	auto commit_offset = writer->GetTotalWritten();
+	written_offset = commit_offset;
+	return commit_offset;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit_offset) {
+	auto &config = DBConfig::Get(database);
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_offset < commit_offset) {
+		if (failed_offset >= commit_offset) {
+			// the sync that included this commit failed
+			throw IOException("Failed to sync the WAL: %s", sync_error);
+		}
+		if (sync_in_progress) {
+			// another thread is syncing the WAL - wait for it, its sync might include this commit
+			sync_cv.wait(guard);
+			continue;
+		}
+		// this thread syncs the WAL for all commits that have been written so far
+		sync_in_progress = true;
+		guard.unlock();
+		auto delay = config.options.wal_group_commit_delay;
+		if (delay > 0) {
+			// give concurrently committing transactions the chance to join this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(delay));
+		}
+		idx_t sync_offset = written_offset;
+		string error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			ErrorData error_data(ex);
+			error = error_data.RawMessage();
+		}
+		guard.lock();
+		sync_in_progress = false;
+		if (error.empty()) {
+			synced_offset = MaxValue(synced_offset, sync_offset);
+		} else {
+			failed_offset = MaxValue(failed_offset, sync_offset);
+			sync_error = error;
+		}
+		sync_cv.notify_all();
+	}
 }
 
 } // namespace duckdb
@@ -188,6 +188,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 		storage->Commit();
 		commit_state = storage_manager.GenStorageCommitState(*log);
 		undo_buffer.WriteToWAL(*log);
+		commit_state->WriteCommit();
 	} catch (std::exception &ex) {
 		if (commit_state) {
 			commit_state->RevertCommit();
@@ -13,6 +13,7 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -30,6 +31,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpointer();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -96,12 +98,6 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (!transaction.AutomaticCheckpoint(db, undo_properties)) {
 		return CheckpointDecision("no reason to automatically checkpoint");
 	}
-	// try to lock the checkpoint lock
-	lock = transaction.TryGetCheckpointLock();
-	if (!lock) {
-		return CheckpointDecision("Failed to obtain checkpoint lock - another thread is writing/checkpointing or "
-		                          "another read transaction relies on data that is not yet committed");
-	}
 	auto checkpoint_type = CheckpointType::FULL_CHECKPOINT;
 	if (undo_properties.has_updates || undo_properties.has_deletes || undo_properties.has_dropped_entries) {
 		// if we have made updates/deletes/catalog changes in this transaction we might need to change our strategy
@@ -136,6 +132,17 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 			}
 		}
 	}
+	if (DBConfig::GetConfig(db.GetDatabase()).options.background_checkpoint) {
+		// the changes of this transaction are written to the WAL and the checkpoint is performed in the background
+		ScheduleBackgroundCheckpoint();
+		return CheckpointDecision("checkpoint is performed in the background");
+	}
+	// try to lock the checkpoint lock
+	lock = transaction.TryGetCheckpointLock();
+	if (!lock) {
+		return CheckpointDecision("Failed to obtain checkpoint lock - another thread is writing/checkpointing or "
+		                          "another read transaction relies on data that is not yet committed");
+	}
 	return CheckpointDecision(checkpoint_type);
 }
 
@@ -190,6 +197,115 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	lock_guard<mutex> guard(checkpointer_lock);
+	if (checkpointer_stopped) {
+		return;
+	}
+	checkpoint_requested = true;
+	if (!checkpointer_thread) {
+		checkpointer_thread = make_uniq<thread>([this]() { RunBackgroundCheckpointer(); });
+	}
+	checkpointer_cv.notify_one();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpointer() {
+	unique_ptr<thread> checkpointer;
+	{
+		lock_guard<mutex> guard(checkpointer_lock);
+		checkpointer_stopped = true;
+		checkpointer = std::move(checkpointer_thread);
+		checkpointer_cv.notify_one();
+	}
+	if (checkpointer) {
+		checkpointer->join();
+	}
+}
+
+void DuckTransactionManager::NotifyBackgroundCheckpointer() {
+	if (!DBConfig::GetConfig(db.GetDatabase()).options.background_checkpoint) {
+		return;
+	}
+	lock_guard<mutex> guard(checkpointer_lock);
+	if (!checkpoint_requested) {
+		return;
+	}
+	transaction_finished = true;
+	checkpointer_cv.notify_one();
+}
+
+void DuckTransactionManager::RunBackgroundCheckpointer() {
+	// while writers are active we cannot checkpoint - we retry when a transaction finishes, but at most every
+	// MIN_RETRY_INTERVAL, and otherwise back off exponentially up to MAX_RETRY_INTERVAL
+	static constexpr const auto MIN_RETRY_INTERVAL = std::chrono::milliseconds(10);
+	static constexpr const auto MAX_RETRY_INTERVAL = std::chrono::milliseconds(1000);
+	std::chrono::milliseconds retry_interval = MIN_RETRY_INTERVAL;
+	unique_lock<mutex> guard(checkpointer_lock);
+	while (true) {
+		checkpointer_cv.wait(guard, [&]() { return checkpoint_requested || checkpointer_stopped; });
+		if (checkpointer_stopped) {
+			return;
+		}
+		transaction_finished = false;
+		guard.unlock();
+		bool finished = TryBackgroundCheckpoint();
+		guard.lock();
+		if (finished) {
+			checkpoint_requested = false;
+			retry_interval = MIN_RETRY_INTERVAL;
+			continue;
+		}
+		if (checkpointer_cv.wait_for(guard, MIN_RETRY_INTERVAL, [&]() { return checkpointer_stopped; })) {
+			continue;
+		}
+		checkpointer_cv.wait_for(guard, retry_interval - MIN_RETRY_INTERVAL,
+		                         [&]() { return checkpointer_stopped || transaction_finished; });
+		retry_interval = MinValue(retry_interval * 2, MAX_RETRY_INTERVAL);
+	}
+}
+
+bool DuckTransactionManager::TryBackgroundCheckpoint() {
+	// the checkpoint only starts when there are no active writers, writers that start while the checkpoint is running
+	// wait for it to finish - but committing transactions never have to perform the checkpoint themselves
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return false;
+	}
+	CheckpointOptions options;
+	options.max_write_rate = DBConfig::GetConfig(db.GetDatabase()).options.background_checkpoint_max_write_rate;
+	options.checkpoint_lock = &checkpoint_lock;
+	bool had_unsafe_changes;
+	{
+		lock_guard<mutex> guard(transaction_lock);
+		had_unsafe_changes = has_unsafe_changes;
+		if (!active_transactions.empty()) {
+			if (has_unsafe_changes && GetLastCommit() > LowestActiveStart()) {
+				// a checkpoint cleans up updates and dropped catalog entries - these might still be needed by
+				// transactions that started before they were committed: wait for these transactions to finish
+				return false;
+			}
+			// we cannot vacuum deletes while transactions are active
+			options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		}
+		has_unsafe_changes = false;
+	}
+	try {
+		db.GetStorageManager().CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		if (had_unsafe_changes) {
+			lock_guard<mutex> guard(transaction_lock);
+			has_unsafe_changes = true;
+		}
+		// the changes are still in the WAL, so they are checkpointed later on - unless the database was left in an
+		// invalid state
+		ErrorData error(ex);
+		if (Exception::InvalidatesDatabase(error.Type())) {
+			ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+		}
+	}
+	return true;
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -221,8 +337,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
 	ErrorData error;
-	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	bool wal_flushed = false;
+	// if the commit is reverted, the order in which the changes of the transaction are rolled back
+	optional_idx rollback_order;
+	// held while reverted commits are rolled back, so no other transaction appends to the tables in the mean time
+	unique_lock<mutex> revert_wal_guard;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -237,29 +357,97 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		}
 		// unlock the transaction lock while we write to the WAL
 		tlock.unlock();
-		// grab the WAL lock and hold it until the entire commit is finished
-		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
-		error = transaction.WriteToWAL(db, commit_state);
+		optional_idx commit_order;
+		{
+			// grab the WAL lock while the changes of the transaction are written to the WAL
+			lock_guard<mutex> wal_guard(wal_lock);
+			error = transaction.WriteToWAL(db, commit_state);
+			if (!error.HasError()) {
+				// the transaction is committed in memory in the order in which its commit was written to the WAL
+				commit_order = next_commit_order++;
+			}
+		}
+		if (!error.HasError()) {
+			// sync the WAL without holding the WAL lock: other transactions can write their changes to the WAL in the
+			// mean time, and transactions that commit concurrently share a single sync
+			try {
+				commit_state->FlushCommit();
+				wal_flushed = true;
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+		}
 
 		// after we finish writing to the WAL we grab the transaction lock again
 		tlock.lock();
+		if (commit_order.IsValid()) {
+			// wait until all transactions that were written to the WAL before this one have been committed or reverted
+			auto order = commit_order.GetIndex();
+			commit_order_cv.wait(tlock, [&]() { return current_commit_order == order; });
+			if (order < reverted_commit_order) {
+				// an earlier commit failed and removed this commit from the WAL as well
+				commit_state->MarkReverted();
+				commit_state.reset();
+				wal_flushed = false;
+				rollback_order = order;
+				if (!error.HasError()) {
+					error = ErrorData(ExceptionType::TRANSACTION,
+					                  "Failed to commit: a transaction that committed concurrently failed to write to "
+					                  "the WAL");
+				}
+			} else if (error.HasError()) {
+				// remove the changes of the transaction from the WAL again - this also removes the commits of the
+				// transactions that were written after it, which will fail as well
+				revert_wal_guard = unique_lock<mutex>(wal_lock);
+				try {
+					commit_state->RevertCommit();
+				} catch (std::exception &revert_ex) {
+					error = ErrorData(revert_ex);
+				}
+				commit_state.reset();
+				reverted_commit_order = next_commit_order;
+				next_rollback_order = next_commit_order;
+				rollback_order = order;
+			}
+			current_commit_order++;
+			commit_order_cv.notify_all();
+			if (rollback_order.IsValid()) {
+				// rolling back appends truncates the tables - the transactions that appended last are rolled back first
+				commit_order_cv.wait(tlock, [&]() { return next_rollback_order == order + 1; });
+			}
+		}
 	}
 	// obtain a commit id for the transaction
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
 		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		if (error.HasError() && wal_flushed) {
+			// the changes are already persistent in the WAL, but could not be committed in memory
+			error = ErrorData(ExceptionType::FATAL,
+			                  "Failed to commit a transaction that was written to the WAL: " + error.RawMessage());
+		}
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint_decision = CheckpointDecision(error.Message());
 		transaction.commit_id = 0;
 		transaction.Rollback();
+		if (rollback_order.IsValid()) {
+			next_rollback_order = rollback_order.GetIndex();
+			commit_order_cv.notify_all();
+			if (revert_wal_guard.owns_lock()) {
+				revert_wal_guard.unlock();
+			}
+		}
 	} else {
 		// check if catalog changes were made
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (undo_properties.has_updates || undo_properties.has_dropped_entries) {
+			has_unsafe_changes = true;
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -396,6 +584,10 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 		// we garbage collected transactions: remove them from the list
 		old_transactions.erase(old_transactions.begin(), old_transactions.begin() + static_cast<int64_t>(i));
 	}
+	// the transaction (or a garbage collected one) might have held a write lock that kept the background checkpointer
+	// from checkpointing
+	current_transaction.reset();
+	NotifyBackgroundCheckpointer();
 }
 
 idx_t DuckTransactionManager::GetCatalogVersion(Transaction &transaction_p) {
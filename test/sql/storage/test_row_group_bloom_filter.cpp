@@ -0,0 +1,72 @@
+#include "catch.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+
+//! Returns the start of the first row group that the scan does not skip, or DConstants::INVALID_INDEX if all row groups
+//! are skipped
+static idx_t FirstScannedRowGroup(Connection &con, duckdb::unique_ptr<TableFilter> filter) {
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(*con.context, INVALID_CATALOG, DEFAULT_SCHEMA, "bloom");
+	auto &storage = table.GetStorage();
+
+	TableFilterSet filters;
+	filters.PushFilter(0, std::move(filter));
+	duckdb::vector<column_t> column_ids {1};
+	TableScanState scan_state;
+	storage.InitializeScan(scan_state, column_ids, &filters);
+	auto row_group = scan_state.table_state.row_group;
+	return row_group ? row_group->start : DConstants::INVALID_INDEX;
+}
+
+static duckdb::unique_ptr<TableFilter> EqualsFilter(const string &value) {
+	return make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, Value(value));
+}
+
+TEST_CASE("Test that row group Bloom filters skip row groups", "[storage]") {
+	auto storage_database = TestCreatePath("row_group_bloom_filter_test");
+	DeleteDatabase(storage_database);
+
+	DuckDB db(storage_database);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET enable_row_group_bloom_filters=true"));
+	REQUIRE_NO_FAIL(con.Query("SET storage_compatibility_version='latest'"));
+	// the values are shuffled, so the min/max statistics of every row group cover (almost) the entire domain
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE bloom AS SELECT i AS id, 'key_' || ((i * 7919) % 500000) AS s "
+	                          "FROM range(500000) t(i)"));
+	REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+
+	auto result = con.Query("SELECT id FROM bloom WHERE s = 'key_499999'");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(482321)}));
+	auto last_row_group_start = 482321 / Storage::ROW_GROUP_SIZE * Storage::ROW_GROUP_SIZE;
+
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	// the row groups before the one that contains the value are skipped
+	REQUIRE(FirstScannedRowGroup(con, EqualsFilter("key_499999")) == last_row_group_start);
+	// values that are not in the table skip every row group
+	REQUIRE(FirstScannedRowGroup(con, EqualsFilter("key_500000")) == DConstants::INVALID_INDEX);
+
+	// IN-lists are pushed as an OR of equality filters - a row group is skipped if it contains none of the values
+	auto in_filter = make_uniq<ConjunctionOrFilter>();
+	in_filter->child_filters.push_back(EqualsFilter("key_missing"));
+	in_filter->child_filters.push_back(EqualsFilter("key_499999"));
+	REQUIRE(FirstScannedRowGroup(con, std::move(in_filter)) == last_row_group_start);
+
+	auto missing_filter = make_uniq<ConjunctionOrFilter>();
+	missing_filter->child_filters.push_back(EqualsFilter("key_missing"));
+	missing_filter->child_filters.push_back(EqualsFilter("key_500001"));
+	REQUIRE(FirstScannedRowGroup(con, std::move(missing_filter)) == DConstants::INVALID_INDEX);
+
+	// other comparisons cannot use the Bloom filter
+	auto not_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_NOTEQUAL, Value("key_500000"));
+	REQUIRE(FirstScannedRowGroup(con, std::move(not_equals)) == 0);
+	REQUIRE_NO_FAIL(con.Query("COMMIT"));
+	DeleteDatabase(storage_database);
+}
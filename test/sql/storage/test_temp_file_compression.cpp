@@ -0,0 +1,84 @@
+#include "catch.hpp"
+#include "duckdb/common/file_buffer.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_file_manager.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+
+//! Counts the temporary files with full-size slots and the ones with smaller slots, that hold compressed blocks
+static void CountTemporaryFiles(TemporaryFileManager &manager, idx_t &uncompressed_files, idx_t &compressed_files) {
+	uncompressed_files = 0;
+	compressed_files = 0;
+	for (auto &file : manager.GetTemporaryFiles()) {
+		if (StringUtil::Contains(file.path, "duckdb_temp_storage_")) {
+			compressed_files++;
+		} else {
+			uncompressed_files++;
+		}
+	}
+}
+
+//! Writes three blocks and reads them back - the first three blocks try every compression level once (uncompressed,
+//! ZSTD -3 and ZSTD 1), so the slots they are written to only depend on how well the data compresses
+static void WriteAndReadBlocks(DatabaseInstance &db, const string &temp_directory, bool compressible,
+                               idx_t &uncompressed_files, idx_t &compressed_files) {
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	TemporaryFileManager manager(db, temp_directory);
+	manager.SetMaxSwapSpace(optional_idx(100 * buffer_manager.GetBlockAllocSize()));
+
+	RandomEngine random(42);
+	duckdb::vector<duckdb::unique_ptr<FileBuffer>> blocks;
+	for (block_id_t block_id = 0; block_id < 3; block_id++) {
+		auto block =
+		    make_uniq<FileBuffer>(Allocator::Get(db), FileBufferType::MANAGED_BUFFER, buffer_manager.GetBlockSize());
+		auto data = block->InternalBuffer();
+		for (idx_t i = 0; i < block->AllocSize(); i++) {
+			data[i] = compressible ? data_t(i % 7) : data_t(random.NextRandomInteger());
+		}
+		manager.WriteTemporaryBuffer(block_id, *block);
+		blocks.push_back(std::move(block));
+	}
+	CountTemporaryFiles(manager, uncompressed_files, compressed_files);
+
+	for (block_id_t block_id = 0; block_id < 3; block_id++) {
+		auto &expected = *blocks[NumericCast<idx_t>(block_id)];
+		auto result = manager.ReadTemporaryBuffer(block_id, nullptr);
+		REQUIRE(result->size == expected.size);
+		REQUIRE(memcmp(result->buffer, expected.buffer, expected.size) == 0);
+	}
+	REQUIRE(manager.GetTemporaryFiles().empty());
+}
+
+TEST_CASE("Test compressing blocks written to temporary files", "[storage]") {
+	DBConfig config;
+	config.options.temp_file_compression = true;
+	DuckDB db(nullptr, &config);
+	auto &instance = *db.instance;
+
+	auto temp_directory = TestCreatePath("temp_file_compression_test");
+	TestDeleteDirectory(temp_directory);
+	TestCreateDirectory(temp_directory);
+
+	idx_t uncompressed_files;
+	idx_t compressed_files;
+	// compressible blocks are written to smaller slots (except for the uncompressed one)
+	WriteAndReadBlocks(instance, temp_directory, true, uncompressed_files, compressed_files);
+	REQUIRE(uncompressed_files == 1);
+	REQUIRE(compressed_files >= 1);
+
+	// blocks that do not compress to a smaller slot fall back to being written uncompressed
+	WriteAndReadBlocks(instance, temp_directory, false, uncompressed_files, compressed_files);
+	REQUIRE(uncompressed_files == 1);
+	REQUIRE(compressed_files == 0);
+
+	// without compression every block is written uncompressed
+	instance.config.options.temp_file_compression = false;
+	WriteAndReadBlocks(instance, temp_directory, true, uncompressed_files, compressed_files);
+	REQUIRE(uncompressed_files == 1);
+	REQUIRE(compressed_files == 0);
+
+	TestDeleteDirectory(temp_directory);
+}
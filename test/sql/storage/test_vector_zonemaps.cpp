@@ -0,0 +1,58 @@
+#include "catch.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+
+TEST_CASE("Test that vector zonemaps skip vectors within a segment", "[storage]") {
+	auto storage_database = TestCreatePath("vector_zonemap_test");
+	DeleteDatabase(storage_database);
+
+	DuckDB db(storage_database);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET storage_compatibility_version='latest'"));
+	// every vector holds a single value - the even vectors hold 0, the odd vectors hold 100
+	// the segments contain both values, so only the vector statistics can prune them
+	auto vector_size = to_string(STANDARD_VECTOR_SIZE);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT CASE WHEN (i // " + vector_size +
+	                          ") % 2 = 0 THEN 0 ELSE 100 END AS v FROM range(" + vector_size + " * 10) t(i)"));
+	REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	{
+		auto &table = Catalog::GetEntry<TableCatalogEntry>(*con.context, INVALID_CATALOG, DEFAULT_SCHEMA, "t");
+		auto &storage = table.GetStorage();
+
+		TableFilterSet filters;
+		filters.PushFilter(0, make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, Value::INTEGER(100)));
+		duckdb::vector<column_t> column_ids {0};
+		TableScanState scan_state;
+		storage.InitializeScan(scan_state, column_ids, &filters);
+
+		auto &state = scan_state.table_state;
+		REQUIRE(state.row_group);
+		REQUIRE(state.vector_index == 0);
+		for (idx_t vector_idx = 0; vector_idx < 10; vector_idx += 2) {
+			// the even vector is skipped without being scanned
+			REQUIRE(!state.row_group->CheckZonemapSegments(state));
+			REQUIRE(state.vector_index == vector_idx + 1);
+			// the odd vector has to be scanned
+			REQUIRE(state.row_group->CheckZonemapSegments(state));
+			REQUIRE(state.vector_index == vector_idx + 1);
+			state.row_group->NextVector(state);
+		}
+	}
+	REQUIRE_NO_FAIL(con.Query("COMMIT"));
+
+	// updated vectors are no longer covered by the statistics and are not skipped
+	REQUIRE_NO_FAIL(con.Query("UPDATE t SET v = 100 WHERE v = 0"));
+	auto result = con.Query("SELECT COUNT(*) FROM t WHERE v = 100");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(STANDARD_VECTOR_SIZE * 10)}));
+	DeleteDatabase(storage_database);
+}
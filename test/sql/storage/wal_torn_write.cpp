@@ -2,6 +2,10 @@
 #include "duckdb/common/file_system.hpp"
 #include "test_helpers.hpp"
 #include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+
+#include <thread>
 
 using namespace duckdb;
 using namespace std;
@@ -116,3 +120,82 @@ TEST_CASE("Test WAL checksums", "[storage][.]") {
 	}
 	DeleteDatabase(storage_database);
 }
+
+//! Handles the WAL files, and fails their syncs on request
+class FailingWALSyncFileSystem : public LocalFileSystem {
+public:
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::EndsWith(fpath, ".wal");
+	}
+	std::string GetName() const override {
+		return "FailingWALSyncFileSystem";
+	}
+	void FileSync(FileHandle &handle) override {
+		if (fail_wal_sync) {
+			throw IOException("Injected WAL sync failure");
+		}
+		LocalFileSystem::FileSync(handle);
+	}
+
+	atomic<bool> fail_wal_sync {false};
+};
+
+TEST_CASE("Test failing WAL syncs of concurrent commits", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("wal_sync_failure");
+
+	auto wal_file_system = make_uniq<FailingWALSyncFileSystem>();
+	auto &failing_fs = *wal_file_system;
+	auto file_system = make_uniq<VirtualFileSystem>();
+	file_system->RegisterSubSystem(std::move(wal_file_system));
+	config->file_system = std::move(file_system);
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	// give concurrent commits the chance to share the failing sync
+	config->options.wal_group_commit_delay = 10000;
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers (i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+
+		// every commit that shares the failing sync has to fail - without invalidating the database
+		failing_fs.fail_wal_sync = true;
+		const idx_t thread_count = 8;
+		duckdb::vector<duckdb::unique_ptr<Connection>> connections;
+		for (idx_t i = 0; i < thread_count; i++) {
+			connections.push_back(make_uniq<Connection>(db));
+		}
+		atomic<idx_t> failed_commits {0};
+		duckdb::vector<std::thread> threads;
+		for (idx_t i = 0; i < thread_count; i++) {
+			threads.emplace_back([&, i]() {
+				auto result = connections[i]->Query("INSERT INTO integers VALUES (" + to_string(i + 100) + ")");
+				if (result->HasError()) {
+					failed_commits++;
+				}
+			});
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+		REQUIRE(failed_commits == thread_count);
+		failing_fs.fail_wal_sync = false;
+
+		// the database is still usable, and none of the failed commits are visible
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (2)"));
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {2}));
+		REQUIRE(CHECK_COLUMN(result, 1, {3}));
+	}
+	{
+		// after a restart only the successful commits are replayed from the WAL
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {2}));
+		REQUIRE(CHECK_COLUMN(result, 1, {3}));
+	}
+	DeleteDatabase(storage_database);
+}